@@ -23,9 +23,13 @@
 #include <deque>
 
 #include "bridge_event_handle.h"
+#include "bridge_method_metrics.h"
+#include "bridge_stream_channel.h"
+#include "bridge_task_batcher.h"
 #include "buffer_mapping.h"
 #include "error_code.h"
 #include "method_data.h"
+#include "method_data_registry.h"
 #include "napi/native_api.h"
 
 namespace OHOS::Plugin::Bridge {
@@ -60,6 +64,19 @@ public:
     ErrorCode SendMessageBinary(const std::vector<uint8_t>& data, std::shared_ptr<MethodData>& methodData);
     CodecType SetCodecType(const CodecType& codecType) { return codecType_ = codecType; };
     CodecType GetCodecType() { return codecType_; };
+    void SetBatchMode(bool batchMode);
+    bool GetBatchMode(void);
+    BridgeBatchStats GetBatchStats(void);
+    void SetMetricsEnabled(bool enabled);
+    bool GetMetricsEnabled(void);
+    std::vector<BridgeMethodStats> GetMethodStats(void);
+    void SetMetricsTraceListener(const BridgeMethodMetrics::TraceListener& listener);
+    ErrorCode OpenStream(const std::string& streamName, uint32_t credits,
+        std::shared_ptr<BridgeStreamChannel>& channel);
+    ErrorCode WriteStream(const std::shared_ptr<BridgeStreamChannel>& channel, const uint8_t* data, size_t size);
+    ErrorCode CloseStream(const std::shared_ptr<BridgeStreamChannel>& channel);
+    ErrorCode RegisterStreamReceiver(const std::shared_ptr<BridgeStreamReceiver>& receiver);
+    ErrorCode UnRegisterStreamReceiver(const std::string& streamName);
 
 private:
     std::string bridgeName_;
@@ -67,19 +84,38 @@ private:
     bool available_ = false;
     bool terminate_ = false;
     napi_env env_ = nullptr;
-    std::map<std::string, std::shared_ptr<MethodData>> platformMethodDataList_;
-    std::map<std::string, std::shared_ptr<MethodData>> jsMethodDataList_;
+    MethodDataRegistry platformMethodDataList_;
+    MethodDataRegistry jsMethodDataList_;
     std::deque<std::shared_ptr<MethodData>> jsSendMessageDataList_;
     std::shared_ptr<MethodData> messageCallback_;
-    std::mutex platformMethodDataListLock_;
-    std::mutex jsMethodDataListLock_;
     std::mutex jsSendMessageDataListLock_;
     std::shared_ptr<BridgeEventHandle> taskExecutor_ = BridgeEventHandle::GetInstance();
+    std::shared_ptr<BridgeTaskBatcher> taskBatcher_ = nullptr;
+    std::mutex taskBatcherLock_;
+    std::shared_ptr<BridgeMethodMetrics> methodMetrics_ = nullptr;
+    BridgeMethodMetrics::TraceListener metricsTraceListener_ = nullptr;
+    std::mutex methodMetricsLock_;
+    std::map<std::string, std::shared_ptr<BridgeStreamChannel>> streamFrameList_;
+    std::map<std::string, std::shared_ptr<BridgeStreamReceiver>> streamReceiverList_;
+    std::mutex streamFrameListLock_;
 
     std::shared_ptr<MethodData> FindPlatformMethodData(const std::string& methodName);
     std::shared_ptr<MethodData> FindJSMethodData(const std::string& methodName);
     void EraseJSMethodData(const std::string& methodName);
     void EraseJSMessageData(void);
+    void PostBridgeTask(const Task& task);
+    std::shared_ptr<BridgeMethodMetrics> GetMethodMetrics(void);
+    int64_t RecordCallStart(const std::string& methodName, size_t requestBytes);
+    void RecordCallEnd(const std::string& methodName, int64_t startTime, size_t responseBytes);
+    void RecordCallCancel(const std::string& methodName);
+    ErrorCode SendStreamFrame(const std::shared_ptr<BridgeStreamChannel>& channel,
+        StreamFrameType type, const uint8_t* data, size_t size);
+    std::shared_ptr<BridgeStreamChannel> TakeStreamFrame(const std::string& methodName);
+    void PurgeStreamFrames(const std::shared_ptr<BridgeStreamChannel>& channel);
+    void ReleaseStreams(void);
+    std::shared_ptr<BridgeStreamReceiver> FindStreamReceiver(const std::string& streamName);
+    void OnPlatformStreamFrame(const std::shared_ptr<BridgeStreamReceiver>& receiver,
+        const std::string& methodName, std::unique_ptr<Ace::Platform::BufferMapping> data);
     void OnPlatformCallMethod(const std::string& methodName, const std::string& parameter);
     void OnPlatformMethodResult(const std::string& methodName, const std::string& result);
     void OnPlatformSendMessage(const std::string& data);
@@ -33,6 +33,16 @@ public:
         static constexpr const char* FUNCTION_REGISTER_ON_MESSAGE = "setMessageListener";
         static constexpr const char* FUNCTION_CALL_METHOD_CALLBACK = "callMethodWithCallback";
         static constexpr const char* FUNCTION_CALL_METHOD_SYNC = "callMethodSync";
+        static constexpr const char* FUNCTION_SET_BATCH_MODE = "setBatchMode";
+        static constexpr const char* FUNCTION_GET_BATCH_STATS = "getBatchStats";
+        static constexpr const char* FUNCTION_OPEN_STREAM = "openStream";
+        static constexpr const char* FUNCTION_WRITE_STREAM = "writeStream";
+        static constexpr const char* FUNCTION_CLOSE_STREAM = "closeStream";
+        static constexpr const char* FUNCTION_REGISTER_STREAM = "registerStream";
+        static constexpr const char* FUNCTION_UNREGISTER_STREAM = "unRegisterStream";
+        static constexpr const char* FUNCTION_SET_METRICS_ENABLED = "setMetricsEnabled";
+        static constexpr const char* FUNCTION_GET_METHOD_STATS = "getMethodStats";
+        static constexpr const char* FUNCTION_SET_METRICS_TRACE_LISTENER = "setMetricsTraceListener";
 
         static napi_value GetBridgeName(napi_env env, napi_callback_info info);
         static napi_value CallMethod(napi_env env, napi_callback_info info);
@@ -42,6 +52,16 @@ public:
         static napi_value SetMessageListener(napi_env env, napi_callback_info info);
         static napi_value CallMethodWithCallBack(napi_env env, napi_callback_info info);
         static napi_value CallMethodSync(napi_env env, napi_callback_info info);
+        static napi_value SetBatchMode(napi_env env, napi_callback_info info);
+        static napi_value GetBatchStats(napi_env env, napi_callback_info info);
+        static napi_value OpenStream(napi_env env, napi_callback_info info);
+        static napi_value WriteStream(napi_env env, napi_callback_info info);
+        static napi_value CloseStream(napi_env env, napi_callback_info info);
+        static napi_value RegisterStream(napi_env env, napi_callback_info info);
+        static napi_value UnRegisterStream(napi_env env, napi_callback_info info);
+        static napi_value SetMetricsEnabled(napi_env env, napi_callback_info info);
+        static napi_value GetMethodStats(napi_env env, napi_callback_info info);
+        static napi_value SetMetricsTraceListener(napi_env env, napi_callback_info info);
     };
 
     static constexpr const char* FUNCTION_CREATE_PLUGIN_BRIDGE = "createBridge";
@@ -68,6 +88,8 @@ private:
         std::shared_ptr<MethodData> onMessageCallback);
     static napi_value InitCodecType(napi_env env);
     static napi_value CallMethodWithCallBackInner(napi_env env, napi_callback_info info);
+    static std::shared_ptr<BridgeStreamChannel> GetStreamChannel(napi_env env, napi_value stream);
+    static void SetInt64Property(napi_env env, napi_value object, const std::string& name, int64_t value);
 };
 } // namespace OHOS::Plugin::Bridge
 #endif
\ No newline at end of file
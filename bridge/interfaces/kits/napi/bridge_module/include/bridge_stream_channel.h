@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PLUGINS_BRIDGE_BRIDGE_STREAM_CHANNEL_H
+#define PLUGINS_BRIDGE_BRIDGE_STREAM_CHANNEL_H
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "error_code.h"
+
+namespace OHOS::Plugin::Bridge {
+enum class StreamFrameType : int32_t {
+    STREAM_OPEN = 0,
+    STREAM_DATA,
+    STREAM_CLOSE,
+};
+
+/*
+ * Sender side of a chunked binary stream. Every OPEN and DATA frame takes one
+ * credit and the platform acknowledgement of that frame gives it back, so at
+ * most `credits` encoded chunks are queued towards the platform at any time.
+ * CLOSE takes no credit.
+ */
+class BridgeStreamChannel {
+public:
+    using CreditListener = std::function<void(uint32_t credits)>;
+    static constexpr uint32_t DEFAULT_STREAM_CREDITS = 8;
+
+    BridgeStreamChannel(const std::string& streamName, uint32_t credits);
+    ~BridgeStreamChannel() = default;
+
+    const std::string& GetStreamName(void) const { return streamName_; }
+    uint32_t GetCredits(void);
+    bool IsClosed(void);
+    void SetCreditListener(const CreditListener& listener);
+
+    // Takes one credit unless the frame is CLOSE and encodes it, a CodecableList of [type, sequence, payload].
+    ErrorCode TakeFrame(StreamFrameType type, const uint8_t* data, size_t size, std::vector<uint8_t>& frame);
+    // Gives the credit of an acknowledged frame back, a failed acknowledgement closes the stream.
+    void OnFrameAcked(int errorCode);
+
+    static void EncodeFrame(StreamFrameType type, int64_t sequence,
+        const uint8_t* data, size_t size, std::vector<uint8_t>& frame);
+    // The payload points into the frame buffer, which must outlive it.
+    static bool DecodeFrame(const uint8_t* frame, size_t frameSize, StreamFrameType& type, int64_t& sequence,
+        const uint8_t*& data, size_t& size);
+
+private:
+    std::string streamName_;
+    uint32_t credits_ = DEFAULT_STREAM_CREDITS;
+    int64_t sequence_ = 0;
+    bool closed_ = false;
+    std::mutex lock_;
+    CreditListener creditListener_;
+};
+
+/*
+ * Receiver side of a stream sent by the platform. Frames arrive as binary calls
+ * on the stream name and use the sender's encoding; the result the bridge sends
+ * back once the listener has consumed a frame is the platform's credit.
+ */
+class BridgeStreamReceiver {
+public:
+    using FrameListener = std::function<void(StreamFrameType type, const uint8_t* data, size_t size)>;
+    using DetachListener = std::function<void(void)>;
+
+    BridgeStreamReceiver(const std::string& streamName, const FrameListener& frameListener,
+        const DetachListener& detachListener);
+    ~BridgeStreamReceiver() = default;
+
+    const std::string& GetStreamName(void) const { return streamName_; }
+    // Decodes a frame and hands it to the listener, frames must arrive in sequence from OPEN on.
+    ErrorCode OnFrame(const uint8_t* frame, size_t size);
+    // Drops the listeners on the JS thread, frames that arrive later are refused.
+    void Detach(void);
+
+private:
+    std::string streamName_;
+    int64_t nextSequence_ = 0;
+    bool opened_ = false;
+    std::mutex lock_;
+    FrameListener frameListener_;
+    DetachListener detachListener_;
+};
+} // namespace OHOS::Plugin::Bridge
+#endif
@@ -39,7 +39,6 @@ public:
 
     static std::shared_ptr<MethodData> CreateMethodData(napi_env env, const CodecType& type);
 
-    static int64_t GetSystemTime(void);
     void SetBridgeName(const std::string& bridgeName);
     const std::string& GetBridgeName(void) const;
     void SetMethodName(const std::string& methodName);
@@ -83,6 +82,7 @@ public:
 
     MethodResult PlatformCallMethodSync(const std::string& parameter);
     MethodResult PlatformCallMethodSyncBinary(std::unique_ptr<Ace::Platform::BufferMapping> parameter);
+    MethodResult PlatformCallMethodSyncBinary(const uint8_t* data, size_t size);
 
 private:
     NAPIAsyncEvent* asyncEvent_ = nullptr;
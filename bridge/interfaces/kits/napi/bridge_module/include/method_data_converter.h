@@ -18,6 +18,7 @@
 
 #include "napi/native_api.h"
 #include "codecable_value.h"
+#include "codecable_view.h"
 
 namespace OHOS::Plugin::Bridge {
 class MethodDataConverter {
@@ -31,6 +32,9 @@ public:
     static napi_value ConvertToNapiValue(napi_env env, const CodecableValue& value);
     static void ConvertToNapiValues(napi_env env, const CodecableValue& value, size_t& argc, napi_value* argv);
 
+    static napi_value ConvertToNapiValue(napi_env env, const CodecableView& value);
+    static void ConvertToNapiValues(napi_env env, const CodecableView& value, size_t& argc, napi_value* argv);
+
 private:
     static CodecableValue GainListValue(napi_env env, napi_value value);
     static CodecableValue GainMapValue(napi_env env, napi_value value);
@@ -46,6 +50,12 @@ private:
     static napi_value CreateListInt64Value(napi_env env, const CodecableValue& value);
     static napi_value CreateListDoubleValue(napi_env env, const CodecableValue& value);
     static napi_value CreateListStringValue(napi_env env, const CodecableValue& value);
+
+    static napi_value CreateMapViewValue(napi_env env, const CodecableView& value);
+    static napi_value CreateListStringViewValue(napi_env env, const CodecableView& value);
+    static napi_value CreateStringViewValue(napi_env env, std::string_view value);
+    template <typename T>
+    static napi_value CreateListSpanValue(napi_env env, const CodecableSpan<T>& span);
 };
 } // namespace OHOS::Plugin::Bridge
 #endif
\ No newline at end of file
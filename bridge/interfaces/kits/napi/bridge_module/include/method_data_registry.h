@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PLUGINS_BRIDGE_METHOD_DATA_REGISTRY_H
+#define PLUGINS_BRIDGE_METHOD_DATA_REGISTRY_H
+
+#include <array>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "method_data.h"
+
+namespace OHOS::Plugin::Bridge {
+/*
+ * Method name to MethodData map split into independently locked stripes.
+ * A lookup only holds the stripe of its own name for the duration of the map
+ * access, callers run the method itself on the returned shared_ptr unlocked.
+ */
+class MethodDataRegistry {
+public:
+    MethodDataRegistry() = default;
+    ~MethodDataRegistry() = default;
+
+    MethodDataRegistry(const MethodDataRegistry&) = delete;
+    MethodDataRegistry& operator=(const MethodDataRegistry&) = delete;
+
+    std::shared_ptr<MethodData> Find(const std::string& methodName);
+    // Returns the entry replaced by methodData, if any.
+    std::shared_ptr<MethodData> Insert(const std::string& methodName, const std::shared_ptr<MethodData>& methodData);
+    bool InsertIfAbsent(const std::string& methodName, const std::shared_ptr<MethodData>& methodData);
+    bool Erase(const std::string& methodName);
+    // Drops every entry and returns the names that were registered.
+    std::vector<std::string> Clear(void);
+
+private:
+    static constexpr size_t STRIPE_COUNT = 16;
+
+    struct Stripe {
+        std::mutex lock;
+        std::map<std::string, std::shared_ptr<MethodData>> methods;
+    };
+
+    Stripe& GetStripe(const std::string& methodName);
+
+    std::array<Stripe, STRIPE_COUNT> stripes_;
+};
+} // namespace OHOS::Plugin::Bridge
+#endif
@@ -62,7 +62,7 @@ private:
     napi_value errorResult_ = nullptr;
     napi_value okResult_ = nullptr;
     // for binary codec
-    std::vector<uint8_t>* binaryResult_;
+    std::vector<uint8_t>* binaryResult_ = nullptr;
 
     void GetErrorInfoByErrorCode(void);
 };
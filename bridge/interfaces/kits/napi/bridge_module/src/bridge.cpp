@@ -21,6 +21,7 @@
 #include "bridge_manager.h"
 #include "bridge_receiver.h"
 #include "log.h"
+#include "method_id.h"
 #include "napi/native_api.h"
 #include "napi/native_node_api.h"
 #include "napi_utils.h"
@@ -105,6 +106,10 @@ void Bridge::UnRegisterBridge(const std::string& bridgeName)
     if (!bridgeName.empty()) {
         available_ = false;
         BridgeManager::JSUnRegisterBridge(bridgeName);
+        ReleaseStreams();
+        for (const auto& methodName : jsMethodDataList_.Clear()) {
+            RecordCallCancel(methodName);
+        }
     }
 }
 
@@ -130,22 +135,24 @@ ErrorCode Bridge::CallMethod(const std::string& methodName, const std::shared_pt
         return ErrorCode::BRIDGE_INVALID;
     }
 
-    std::lock_guard<std::mutex> lock(jsMethodDataListLock_);
-
-    methodData->SetStartTime(MethodData::GetSystemTime());
-    jsMethodDataList_[methodName] = methodData;
+    size_t requestBytes = (codecType_ == CodecType::BINARY_CODEC) ?
+        methodData->GetMethodParamNameBinary().size() : methodData->GetMethodParamName().size();
+    methodData->SetStartTime(RecordCallStart(methodName, requestBytes));
+    if (jsMethodDataList_.Insert(methodName, methodData) != nullptr) {
+        // The pending call of the same name can no longer be matched to a result.
+        RecordCallCancel(methodName);
+    }
 
     if (codecType_ == CodecType::JSON_CODEC) {
         auto task = [bridgeName = this->bridgeName_, methodName, parameter = methodData->GetMethodParamName()]() {
             BridgeManager::JSCallMethod(bridgeName, methodName, parameter);
         };
-        taskExecutor_->RunTaskOnBridgeThread(task);
+        PostBridgeTask(task);
     } else if (codecType_ == CodecType::BINARY_CODEC) {
-        const auto& data = methodData->GetMethodParamNameBinary();
-        auto task = [bridgeName = this->bridgeName_, methodName, &data]() {
-            BridgeManager::JSCallMethodBinary(bridgeName, methodName, data);
+        auto task = [bridgeName = this->bridgeName_, methodName, methodData]() {
+            BridgeManager::JSCallMethodBinary(bridgeName, methodName, methodData->GetMethodParamNameBinary());
         };
-        taskExecutor_->RunTaskOnBridgeThread(task);
+        PostBridgeTask(task);
     }
 
     return ErrorCode::BRIDGE_ERROR_NO;
@@ -169,14 +176,17 @@ ErrorCode Bridge::CallMethodSync(napi_env env, const std::string& methodName,
         return ErrorCode::BRIDGE_METHOD_PARAM_ERROR;
     }
 
-    std::lock_guard<std::mutex> lock(jsMethodDataListLock_);
-
     if (codecType_ == CodecType::JSON_CODEC) {
-        auto result = BridgeManager::JSCallMethodSync(bridgeName_, methodName, methodData->GetMethodParamName());
+        const auto& parameter = methodData->GetMethodParamName();
+        int64_t startTime = RecordCallStart(methodName, parameter.size());
+        auto result = BridgeManager::JSCallMethodSync(bridgeName_, methodName, parameter);
+        RecordCallEnd(methodName, startTime, result.size());
         methodResult->ParsePlatformMethodResult(env, result);
     } else if (codecType_ == CodecType::BINARY_CODEC) {
         const auto& data = methodData->GetMethodParamNameBinary();
+        int64_t startTime = RecordCallStart(methodName, data.size());
         auto result = BridgeManager::JSCallMethodBinarySync(bridgeName_, methodName, data);
+        RecordCallEnd(methodName, startTime, result.buffer ? result.buffer->GetSize() : 0);
         methodResult->ParsePlatformMethodResultBinary(env, result.errorCode, "", std::move(result.buffer));
     }
     return ErrorCode::BRIDGE_ERROR_NO;
@@ -209,20 +219,19 @@ ErrorCode Bridge::CallMethodSyncBinary(
         return SetCallMethodSyncBinaryError(methodResult, ErrorCode::BRIDGE_METHOD_PARAM_ERROR,
             "CallMethodSyncBinary: methodData null");
     }
-    std::lock_guard<std::mutex> lock(platformMethodDataListLock_);
     auto platformMethodData = FindPlatformMethodData(methodName);
     if (!platformMethodData) {
         return SetCallMethodSyncBinaryError(methodResult, ErrorCode::BRIDGE_METHOD_UNIMPL,
             "CallMethodSyncBinary: platform method not found");
     }
 
-    std::unique_ptr<Ace::Platform::BufferMapping> paramMapping = nullptr;
+    // Both sides live in this process, so the encoded parameters are handed over without a copy.
     const auto& paramVec = methodData->GetMethodParamNameBinary();
-    if (!paramVec.empty()) {
-        auto copy = Ace::Platform::BufferMapping::Copy(paramVec.data(), paramVec.size());
-        paramMapping = std::make_unique<Ace::Platform::BufferMapping>(copy.Release(), paramVec.size());
-    }
-    methodResult = platformMethodData->PlatformCallMethodSyncBinary(std::move(paramMapping));
+    int64_t startTime = RecordCallStart(methodName, paramVec.size());
+    methodResult = platformMethodData->PlatformCallMethodSyncBinary(
+        paramVec.empty() ? nullptr : paramVec.data(), paramVec.size());
+    auto resultBinary = methodResult.GetResultBinary();
+    RecordCallEnd(methodName, startTime, resultBinary ? resultBinary->size() : 0);
     return ErrorCode::BRIDGE_ERROR_NO;
 }
 
@@ -240,7 +249,7 @@ ErrorCode Bridge::SendMethodResult(const std::string& methodName, const std::str
     auto task = [bridgeName = this->bridgeName_, methodName, result]() {
         BridgeManager::JSSendMethodResult(bridgeName, methodName, result);
     };
-    taskExecutor_->RunTaskOnBridgeThread(task);
+    PostBridgeTask(task);
 
     return ErrorCode::BRIDGE_ERROR_NO;
 }
@@ -263,7 +272,7 @@ ErrorCode Bridge::SendMessage(const std::string& data, std::shared_ptr<MethodDat
     auto task = [bridgeName = this->bridgeName_, data]() {
         BridgeManager::JSSendMessage(bridgeName, data);
     };
-    taskExecutor_->RunTaskOnBridgeThread(task);
+    PostBridgeTask(task);
 
     return ErrorCode::BRIDGE_ERROR_NO;
 }
@@ -282,10 +291,10 @@ ErrorCode Bridge::SendMessageBinary(const std::vector<uint8_t>& data, std::share
 
     std::lock_guard<std::mutex> lock(jsSendMessageDataListLock_);
     jsSendMessageDataList_.push_back(methodData);
-    auto task = [bridgeName = this->bridgeName_, &data]() {
+    auto task = [bridgeName = this->bridgeName_, &data, methodData]() {
         BridgeManager::JSSendMessageBinary(bridgeName, data);
     };
-    taskExecutor_->RunTaskOnBridgeThread(task);
+    PostBridgeTask(task);
 
     return ErrorCode::BRIDGE_ERROR_NO;
 }
@@ -309,7 +318,7 @@ ErrorCode Bridge::SendMessageResponse(const std::string& data)
         LOGE("SendMessageResponse: taskExecutor_ is null.");
         return ErrorCode::BRIDGE_DATA_ERROR;
     }
-    taskExecutor_->RunTaskOnBridgeThread(task);
+    PostBridgeTask(task);
     return ErrorCode::BRIDGE_ERROR_NO;
 }
 
@@ -330,14 +339,10 @@ ErrorCode Bridge::RegisterMethod(const std::string& methodName, const std::share
         return ErrorCode::BRIDGE_METHOD_PARAM_ERROR;
     }
 
-    std::lock_guard<std::mutex> lock(platformMethodDataListLock_);
-    auto platformMethodData = FindPlatformMethodData(methodName);
-    if (platformMethodData) {
+    if (!platformMethodDataList_.InsertIfAbsent(methodName, methodData)) {
         LOGE("RegisterMethod: The %{public}s is exists.", methodName.c_str());
         return ErrorCode::BRIDGE_METHOD_EXISTS;
     }
-
-    platformMethodDataList_[methodName] = methodData;
     return ErrorCode::BRIDGE_ERROR_NO;
 }
 
@@ -353,14 +358,11 @@ ErrorCode Bridge::UnRegisterMethod(const std::string& methodName)
         return ErrorCode::BRIDGE_INVALID;
     }
 
-    std::lock_guard<std::mutex> lock(platformMethodDataListLock_);
-    auto iter = platformMethodDataList_.find(methodName);
-    if (iter != platformMethodDataList_.end()) {
-        platformMethodDataList_.erase(iter);
+    if (platformMethodDataList_.Erase(methodName)) {
         auto task = [bridgeName = this->bridgeName_, methodName]() {
             BridgeManager::JSCancelMethod(bridgeName, methodName);
         };
-        taskExecutor_->RunTaskOnBridgeThread(task);
+        PostBridgeTask(task);
         return ErrorCode::BRIDGE_ERROR_NO;
     }
     return ErrorCode::BRIDGE_METHOD_UNIMPL;
@@ -375,6 +377,266 @@ void Bridge::SetMessageListener(std::shared_ptr<MethodData>& callback)
     messageCallback_ = callback;
 }
 
+void Bridge::SetBatchMode(bool batchMode)
+{
+    std::lock_guard<std::mutex> lock(taskBatcherLock_);
+    if (!batchMode) {
+        // A scheduled flush holds the batcher, so the calls already queued are still sent.
+        taskBatcher_.reset();
+        return;
+    }
+    if (!taskBatcher_) {
+        taskBatcher_ = BridgeTaskBatcher::Create(taskExecutor_);
+    }
+}
+
+bool Bridge::GetBatchMode(void)
+{
+    std::lock_guard<std::mutex> lock(taskBatcherLock_);
+    return taskBatcher_ != nullptr;
+}
+
+BridgeBatchStats Bridge::GetBatchStats(void)
+{
+    std::lock_guard<std::mutex> lock(taskBatcherLock_);
+    if (!taskBatcher_) {
+        return BridgeBatchStats();
+    }
+    return taskBatcher_->GetStats();
+}
+
+// Every bridge-thread post goes through here, so results and cancels cannot overtake batched calls.
+void Bridge::PostBridgeTask(const Task& task)
+{
+    std::shared_ptr<BridgeTaskBatcher> batcher = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(taskBatcherLock_);
+        batcher = taskBatcher_;
+    }
+    if (batcher) {
+        batcher->PostTask(task);
+        return;
+    }
+    taskExecutor_->RunTaskOnBridgeThread(task);
+}
+
+void Bridge::SetMetricsEnabled(bool enabled)
+{
+    std::lock_guard<std::mutex> lock(methodMetricsLock_);
+    if (!enabled) {
+        methodMetrics_.reset();
+        return;
+    }
+    if (!methodMetrics_) {
+        methodMetrics_ = std::make_shared<BridgeMethodMetrics>();
+        methodMetrics_->SetTraceListener(metricsTraceListener_);
+    }
+}
+
+bool Bridge::GetMetricsEnabled(void)
+{
+    std::lock_guard<std::mutex> lock(methodMetricsLock_);
+    return methodMetrics_ != nullptr;
+}
+
+std::vector<BridgeMethodStats> Bridge::GetMethodStats(void)
+{
+    auto metrics = GetMethodMetrics();
+    if (!metrics) {
+        return {};
+    }
+    return metrics->GetSnapshot();
+}
+
+void Bridge::SetMetricsTraceListener(const BridgeMethodMetrics::TraceListener& listener)
+{
+    // Kept on the bridge as well, so the listener survives turning metrics off and on again.
+    std::lock_guard<std::mutex> lock(methodMetricsLock_);
+    metricsTraceListener_ = listener;
+    if (methodMetrics_) {
+        methodMetrics_->SetTraceListener(listener);
+    }
+}
+
+std::shared_ptr<BridgeMethodMetrics> Bridge::GetMethodMetrics(void)
+{
+    std::lock_guard<std::mutex> lock(methodMetricsLock_);
+    return methodMetrics_;
+}
+
+int64_t Bridge::RecordCallStart(const std::string& methodName, size_t requestBytes)
+{
+    auto metrics = GetMethodMetrics();
+    if (metrics) {
+        metrics->OnCallStart(MethodID::FetchMethodName(methodName), requestBytes);
+    }
+    return BridgeMethodMetrics::GetSteadyTime();
+}
+
+void Bridge::RecordCallEnd(const std::string& methodName, int64_t startTime, size_t responseBytes)
+{
+    auto metrics = GetMethodMetrics();
+    if (metrics) {
+        metrics->OnCallEnd(MethodID::FetchMethodName(methodName), startTime, responseBytes);
+    }
+}
+
+void Bridge::RecordCallCancel(const std::string& methodName)
+{
+    auto metrics = GetMethodMetrics();
+    if (metrics) {
+        metrics->OnCallCancel(MethodID::FetchMethodName(methodName));
+    }
+}
+
+ErrorCode Bridge::OpenStream(const std::string& streamName, uint32_t credits,
+    std::shared_ptr<BridgeStreamChannel>& channel)
+{
+    if (streamName.empty()) {
+        LOGE("OpenStream: The streamName is empty.");
+        return ErrorCode::BRIDGE_METHOD_NAME_ERROR;
+    }
+    if (codecType_ != CodecType::BINARY_CODEC) {
+        LOGE("OpenStream: Streams require the binary codec.");
+        return ErrorCode::BRIDGE_CODEC_TYPE_MISMATCH;
+    }
+    auto newChannel = std::make_shared<BridgeStreamChannel>(streamName, credits);
+    ErrorCode code = SendStreamFrame(newChannel, StreamFrameType::STREAM_OPEN, nullptr, 0);
+    if (code == ErrorCode::BRIDGE_ERROR_NO) {
+        channel = newChannel;
+    }
+    return code;
+}
+
+ErrorCode Bridge::WriteStream(const std::shared_ptr<BridgeStreamChannel>& channel, const uint8_t* data, size_t size)
+{
+    if (data == nullptr || size == 0) {
+        LOGE("WriteStream: The data is empty.");
+        return ErrorCode::BRIDGE_DATA_ERROR;
+    }
+    return SendStreamFrame(channel, StreamFrameType::STREAM_DATA, data, size);
+}
+
+ErrorCode Bridge::CloseStream(const std::shared_ptr<BridgeStreamChannel>& channel)
+{
+    ErrorCode code = SendStreamFrame(channel, StreamFrameType::STREAM_CLOSE, nullptr, 0);
+    // A closed channel takes no more credits, so frames that are never acknowledged must not keep it alive.
+    PurgeStreamFrames(channel);
+    return code;
+}
+
+ErrorCode Bridge::RegisterStreamReceiver(const std::shared_ptr<BridgeStreamReceiver>& receiver)
+{
+    if (receiver == nullptr || receiver->GetStreamName().empty()) {
+        LOGE("RegisterStreamReceiver: The receiver is invalid.");
+        return ErrorCode::BRIDGE_METHOD_PARAM_ERROR;
+    }
+    if (codecType_ != CodecType::BINARY_CODEC) {
+        LOGE("RegisterStreamReceiver: Streams require the binary codec.");
+        return ErrorCode::BRIDGE_CODEC_TYPE_MISMATCH;
+    }
+    if (!GetAvailable()) {
+        LOGE("RegisterStreamReceiver: The bridge is unavailable.");
+        return ErrorCode::BRIDGE_INVALID;
+    }
+    std::lock_guard<std::mutex> lock(streamFrameListLock_);
+    if (!streamReceiverList_.emplace(receiver->GetStreamName(), receiver).second) {
+        LOGE("RegisterStreamReceiver: The %{public}s is exists.", receiver->GetStreamName().c_str());
+        return ErrorCode::BRIDGE_METHOD_EXISTS;
+    }
+    return ErrorCode::BRIDGE_ERROR_NO;
+}
+
+ErrorCode Bridge::UnRegisterStreamReceiver(const std::string& streamName)
+{
+    std::shared_ptr<BridgeStreamReceiver> receiver = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(streamFrameListLock_);
+        auto iter = streamReceiverList_.find(streamName);
+        if (iter == streamReceiverList_.end()) {
+            return ErrorCode::BRIDGE_METHOD_UNIMPL;
+        }
+        receiver = iter->second;
+        streamReceiverList_.erase(iter);
+    }
+    receiver->Detach();
+    return ErrorCode::BRIDGE_ERROR_NO;
+}
+
+ErrorCode Bridge::SendStreamFrame(const std::shared_ptr<BridgeStreamChannel>& channel,
+    StreamFrameType type, const uint8_t* data, size_t size)
+{
+    if (channel == nullptr) {
+        LOGE("SendStreamFrame: The channel is null.");
+        return ErrorCode::BRIDGE_METHOD_PARAM_ERROR;
+    }
+    if (!GetAvailable() || !taskExecutor_) {
+        LOGE("SendStreamFrame: %{public}s",
+            GetAvailable() ? "taskExecutor_ is null." : "The bridge is unavailable.");
+        return ErrorCode::BRIDGE_INVALID;
+    }
+    auto frame = std::make_shared<std::vector<uint8_t>>();
+    ErrorCode code = channel->TakeFrame(type, data, size, *frame);
+    if (code != ErrorCode::BRIDGE_ERROR_NO) {
+        return code;
+    }
+
+    // Each frame gets its own method id, so its result is routed back to the channel as the credit.
+    std::string methodName = MethodID::MakeMethodNameID(channel->GetStreamName());
+    {
+        std::lock_guard<std::mutex> lock(streamFrameListLock_);
+        streamFrameList_[methodName] = channel;
+    }
+    auto task = [bridgeName = this->bridgeName_, methodName, frame]() {
+        BridgeManager::JSCallMethodBinary(bridgeName, methodName, *frame);
+    };
+    PostBridgeTask(task);
+    return ErrorCode::BRIDGE_ERROR_NO;
+}
+
+std::shared_ptr<BridgeStreamChannel> Bridge::TakeStreamFrame(const std::string& methodName)
+{
+    std::lock_guard<std::mutex> lock(streamFrameListLock_);
+    auto iter = streamFrameList_.find(methodName);
+    if (iter == streamFrameList_.end()) {
+        return nullptr;
+    }
+    auto channel = iter->second;
+    streamFrameList_.erase(iter);
+    return channel;
+}
+
+void Bridge::PurgeStreamFrames(const std::shared_ptr<BridgeStreamChannel>& channel)
+{
+    if (channel == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(streamFrameListLock_);
+    for (auto iter = streamFrameList_.begin(); iter != streamFrameList_.end();) {
+        iter = (iter->second == channel) ? streamFrameList_.erase(iter) : std::next(iter);
+    }
+}
+
+void Bridge::ReleaseStreams(void)
+{
+    std::map<std::string, std::shared_ptr<BridgeStreamReceiver>> receivers;
+    {
+        std::lock_guard<std::mutex> lock(streamFrameListLock_);
+        streamFrameList_.clear();
+        receivers.swap(streamReceiverList_);
+    }
+    for (const auto& receiver : receivers) {
+        receiver.second->Detach();
+    }
+}
+
+std::shared_ptr<BridgeStreamReceiver> Bridge::FindStreamReceiver(const std::string& streamName)
+{
+    std::lock_guard<std::mutex> lock(streamFrameListLock_);
+    auto iter = streamReceiverList_.find(streamName);
+    return (iter == streamReceiverList_.end()) ? nullptr : iter->second;
+}
+
 void Bridge::SetAvailable(bool available)
 {
     available_ = available;
@@ -387,35 +649,22 @@ bool Bridge::GetAvailable(void)
 
 std::shared_ptr<MethodData> Bridge::FindPlatformMethodData(const std::string& methodName)
 {
-    auto iter = platformMethodDataList_.find(methodName);
-    if (iter != platformMethodDataList_.end()) {
-        return iter->second;
-    }
-    return nullptr;
+    return platformMethodDataList_.Find(methodName);
 }
 
 std::shared_ptr<MethodData> Bridge::FindJSMethodData(const std::string& methodName)
 {
-    std::lock_guard<std::mutex> lock(jsMethodDataListLock_);
-    auto iter = jsMethodDataList_.find(methodName);
-    if (iter != jsMethodDataList_.end()) {
-        return iter->second;
-    }
-    return nullptr;
+    return jsMethodDataList_.Find(methodName);
 }
 
 void Bridge::EraseJSMethodData(const std::string& methodName)
 {
-    std::lock_guard<std::mutex> lock(jsMethodDataListLock_);
-    auto iter = jsMethodDataList_.find(methodName);
-    if (iter != jsMethodDataList_.end()) {
-        jsMethodDataList_.erase(iter);
-    }
+    jsMethodDataList_.Erase(methodName);
 }
 
 void Bridge::EraseJSMessageData(void)
 {
-    std::lock_guard<std::mutex> lock(jsMethodDataListLock_);
+    // Callers hold jsSendMessageDataListLock_.
     if (!jsSendMessageDataList_.empty()) {
         jsSendMessageDataList_.pop_front();
     }
@@ -423,7 +672,9 @@ void Bridge::EraseJSMessageData(void)
 
 void Bridge::RemoveJSMethodData(const std::string& methodName)
 {
-    EraseJSMethodData(methodName);
+    if (jsMethodDataList_.Erase(methodName)) {
+        RecordCallCancel(methodName);
+    }
 }
 
 void Bridge::RemoveMessageData(void)
@@ -444,7 +695,6 @@ bool Bridge::GetTerminate(void)
 
 void Bridge::OnPlatformCallMethod(const std::string& methodName, const std::string& parameter)
 {
-    std::lock_guard<std::mutex> lock(platformMethodDataListLock_);
     std::shared_ptr<MethodData> jsMethodData = FindPlatformMethodData(methodName);
     if (jsMethodData == nullptr) {
         LOGE("OnPlatformCallMethod: The jsMethodData is null.");
@@ -459,7 +709,7 @@ void Bridge::OnPlatformCallMethod(const std::string& methodName, const std::stri
         if (!taskExecutor_) {
             LOGE("OnPlatformCallMethod(error path): taskExecutor_ is null.");
         } else {
-            taskExecutor_->RunTaskOnBridgeThread(task);
+            PostBridgeTask(task);
         }
         return;
     }
@@ -476,7 +726,6 @@ void Bridge::OnPlatformCallMethod(const std::string& methodName, const std::stri
 
 std::string Bridge::OnPlatformCallMethodSync(const std::string& methodName, const std::string& parameter)
 {
-    std::lock_guard<std::mutex> lock(platformMethodDataListLock_);
     std::shared_ptr<MethodData> jsMethodData = FindPlatformMethodData(methodName);
     if (jsMethodData == nullptr) {
         LOGE("OnPlatformCallMethodSync: The jsMethodData is null.");
@@ -492,7 +741,11 @@ std::string Bridge::OnPlatformCallMethodSync(const std::string& methodName, cons
 
 void Bridge::OnPlatformCallMethodBinary(const std::string& methodName, std::unique_ptr<BufferMapping> data)
 {
-    std::lock_guard<std::mutex> lock(platformMethodDataListLock_);
+    auto receiver = FindStreamReceiver(MethodID::FetchMethodName(methodName));
+    if (receiver != nullptr) {
+        OnPlatformStreamFrame(receiver, methodName, std::move(data));
+        return;
+    }
     std::shared_ptr<MethodData> jsMethodData = FindPlatformMethodData(methodName);
     if (jsMethodData == nullptr) {
         LOGE("OnPlatformCallMethodBinary: The jsMethodData is null.");
@@ -507,7 +760,7 @@ void Bridge::OnPlatformCallMethodBinary(const std::string& methodName, std::uniq
         if (!taskExecutor_) {
             LOGE("OnPlatformCallMethodBinary(error path): taskExecutor_ is null.");
         } else {
-            taskExecutor_->RunTaskOnBridgeThread(task);
+            PostBridgeTask(task);
         }
         return;
     }
@@ -527,11 +780,36 @@ void Bridge::OnPlatformCallMethodBinary(const std::string& methodName, std::uniq
     });
 }
 
+void Bridge::OnPlatformStreamFrame(const std::shared_ptr<BridgeStreamReceiver>& receiver,
+    const std::string& methodName, std::unique_ptr<BufferMapping> data)
+{
+    if (!taskExecutor_) {
+        LOGE("OnPlatformStreamFrame: taskExecutor_ is null.");
+        return;
+    }
+    struct BufferHolder { std::unique_ptr<BufferMapping> ptr; };
+    auto holder = std::make_shared<BufferHolder>();
+    holder->ptr = std::move(data);
+    // The frame is acknowledged only after the listener has consumed it, so the platform's credit
+    // follows the pace of the JS consumer.
+    taskExecutor_->RunTaskOnMainThread([receiver, holder, methodName, this]() {
+        ErrorCode code = (holder->ptr == nullptr) ? ErrorCode::BRIDGE_DATA_ERROR :
+            receiver->OnFrame(holder->ptr->GetMapping(), holder->ptr->GetSize());
+        holder->ptr.reset();
+        MethodResult result;
+        result.SetErrorCodeInfo(static_cast<int>(code));
+        auto task = [bridgeName = this->bridgeName_, methodName,
+                        errorCode = result.GetErrorCode(), errorMessage = result.GetErrorMessage()]() {
+            BridgeManager::JSSendMethodResultBinary(bridgeName, methodName, errorCode, errorMessage, nullptr);
+        };
+        PostBridgeTask(task);
+    });
+}
+
 std::unique_ptr<BufferMapping> Bridge::OnPlatformCallMethodSyncBinary(
     const std::string& methodName, std::unique_ptr<BufferMapping> data, int32_t& errorCode)
 {
     errorCode = 0;
-    std::lock_guard<std::mutex> lock(platformMethodDataListLock_);
     std::shared_ptr<MethodData> jsMethodData = FindPlatformMethodData(methodName);
     if (jsMethodData == nullptr) {
         LOGE("OnPlatformCallMethodSyncBinary: method not implemented! The method is %{public}s", methodName.c_str());
@@ -545,7 +823,7 @@ std::unique_ptr<BufferMapping> Bridge::OnPlatformCallMethodSyncBinary(
         errorCode = methodResult.GetErrorCode();
         return nullptr;
     }
-    auto binaryVec = methodResult.GetResultBinary();
+    std::unique_ptr<std::vector<uint8_t>> binaryVec { methodResult.GetResultBinary() };
     if (binaryVec == nullptr || binaryVec->empty()) {
         LOGI("OnPlatformCallMethodSyncBinary: empty result");
         return nullptr;
@@ -569,10 +847,11 @@ void Bridge::OnPlatformMethodResult(const std::string& methodName, const std::st
         if (!taskExecutor_) {
             LOGE("OnPlatformMethodResult(error path): taskExecutor_ is null.");
         } else {
-            taskExecutor_->RunTaskOnBridgeThread(task);
+            PostBridgeTask(task);
         }
         return;
     }
+    RecordCallEnd(methodName, jsMethodData->GetStartTime(), result.size());
     if (!taskExecutor_) {
         LOGE("OnPlatformMethodResult: taskExecutor_ is null.");
         return;
@@ -586,6 +865,15 @@ void Bridge::OnPlatformMethodResult(const std::string& methodName, const std::st
 void Bridge::OnPlatformMethodResultBinary(const std::string& methodName, int errorCode,
     const std::string& errorMessage, std::unique_ptr<BufferMapping> result)
 {
+    std::shared_ptr<BridgeStreamChannel> channel = TakeStreamFrame(methodName);
+    if (channel != nullptr) {
+        if (taskExecutor_) {
+            taskExecutor_->RunTaskOnMainThread([channel, errorCode]() {
+                channel->OnFrameAcked(errorCode);
+            });
+        }
+        return;
+    }
     std::shared_ptr<MethodData> jsMethodData = FindJSMethodData(methodName);
     if (jsMethodData == nullptr) {
         LOGE("OnPlatformMethodResultBinary: The jsMethodData is null.");
@@ -600,10 +888,11 @@ void Bridge::OnPlatformMethodResultBinary(const std::string& methodName, int err
         if (!taskExecutor_) {
             LOGE("OnPlatformMethodResultBinary(error path): taskExecutor_ is null.");
         } else {
-            taskExecutor_->RunTaskOnBridgeThread(task);
+            PostBridgeTask(task);
         }
         return;
     }
+    RecordCallEnd(methodName, jsMethodData->GetStartTime(), result ? result->GetSize() : 0);
     struct BufferHolder { std::unique_ptr<BufferMapping> ptr; };
     auto holder = std::make_shared<BufferHolder>();
     if (!holder) {
@@ -34,6 +34,60 @@ static constexpr const int32_t BRIDGE_TYPE_JSON = 0;
 static constexpr const int32_t BRIDGE_TYPE_BINARY = 1;
 static constexpr const char* BRIDGE_TYPE_ENUM_JSON_NAME = "JSON_TYPE";
 static constexpr const char* BRIDGE_TYPE_ENUM_BINARY_NAME = "BINARY_TYPE";
+static constexpr const char* PROPERTY_STREAM_NAME = "streamName";
+
+// Native side of the stream object returned by openStream.
+struct StreamHandle {
+    std::shared_ptr<BridgeStreamChannel> channel;
+    napi_ref creditCallback = nullptr;
+};
+
+// JS callbacks of a stream registered with registerStream, released when the receiver is detached.
+struct StreamReceiverRefs {
+    napi_ref dataCallback = nullptr;
+    napi_ref closeCallback = nullptr;
+};
+/*
+ * JS function receiving the metrics trace. Calls are recorded on any thread,
+ * so each one is posted to the JS thread, and so is the release of the reference.
+ */
+class TraceCallback : public std::enable_shared_from_this<TraceCallback> {
+public:
+    TraceCallback(napi_env env, napi_ref callback) : env_(env), callback_(callback) {}
+    ~TraceCallback()
+    {
+        auto taskExecutor = BridgeEventHandle::GetInstance();
+        if (taskExecutor) {
+            taskExecutor->RunTaskOnMainThread([env = env_, callback = callback_]() {
+                PluginUtilsNApi::DeleteReference(env, callback);
+            });
+        }
+    }
+
+    void Post(const std::string& methodName, int64_t startTime, int64_t endTime)
+    {
+        auto taskExecutor = BridgeEventHandle::GetInstance();
+        if (!taskExecutor) {
+            return;
+        }
+        auto self = shared_from_this();
+        taskExecutor->RunTaskOnMainThread([self, methodName, startTime, endTime]() {
+            ScopedHandleScope scope(self->env_);
+            napi_value argv[PluginUtilsNApi::ARG_NUM_3] = { PluginUtilsNApi::CreateStringUtf8(self->env_, methodName),
+                nullptr, nullptr };
+            napi_create_int64(self->env_, startTime, &argv[PluginUtilsNApi::ARG_NUM_1]);
+            napi_create_int64(self->env_, endTime, &argv[PluginUtilsNApi::ARG_NUM_2]);
+            napi_value callback = PluginUtilsNApi::GetReference(self->env_, self->callback_);
+            PluginUtilsNApi::CallFunction(self->env_, PluginUtilsNApi::CreateUndefined(self->env_), callback,
+                PluginUtilsNApi::ARG_NUM_3, argv);
+        });
+    }
+
+private:
+    napi_env env_ = nullptr;
+    napi_ref callback_ = nullptr;
+};
+
 napi_value BridgeModule::InitBridgeModule(napi_env env, napi_value exports)
 {
     DefinePluginBridgeObjectClass(env, exports);
@@ -106,6 +160,17 @@ void BridgeModule::DefinePluginBridgeObjectClass(napi_env env, napi_value export
         DECLARE_NAPI_FUNCTION(BridgeObject::FUNCTION_REGISTER_ON_MESSAGE, BridgeObject::SetMessageListener),
         DECLARE_NAPI_FUNCTION(BridgeObject::FUNCTION_CALL_METHOD_CALLBACK, BridgeObject::CallMethodWithCallBack),
         DECLARE_NAPI_FUNCTION(BridgeObject::FUNCTION_CALL_METHOD_SYNC, BridgeObject::CallMethodSync),
+        DECLARE_NAPI_FUNCTION(BridgeObject::FUNCTION_SET_BATCH_MODE, BridgeObject::SetBatchMode),
+        DECLARE_NAPI_FUNCTION(BridgeObject::FUNCTION_GET_BATCH_STATS, BridgeObject::GetBatchStats),
+        DECLARE_NAPI_FUNCTION(BridgeObject::FUNCTION_OPEN_STREAM, BridgeObject::OpenStream),
+        DECLARE_NAPI_FUNCTION(BridgeObject::FUNCTION_WRITE_STREAM, BridgeObject::WriteStream),
+        DECLARE_NAPI_FUNCTION(BridgeObject::FUNCTION_CLOSE_STREAM, BridgeObject::CloseStream),
+        DECLARE_NAPI_FUNCTION(BridgeObject::FUNCTION_REGISTER_STREAM, BridgeObject::RegisterStream),
+        DECLARE_NAPI_FUNCTION(BridgeObject::FUNCTION_UNREGISTER_STREAM, BridgeObject::UnRegisterStream),
+        DECLARE_NAPI_FUNCTION(BridgeObject::FUNCTION_SET_METRICS_ENABLED, BridgeObject::SetMetricsEnabled),
+        DECLARE_NAPI_FUNCTION(BridgeObject::FUNCTION_GET_METHOD_STATS, BridgeObject::GetMethodStats),
+        DECLARE_NAPI_FUNCTION(BridgeObject::FUNCTION_SET_METRICS_TRACE_LISTENER,
+            BridgeObject::SetMetricsTraceListener),
     };
     PluginUtilsNApi::DefineClass(env, exports, properties, INTERFACE_PLUGIN_BRIDGE_OBJECT);
 }
@@ -609,6 +674,421 @@ napi_value BridgeModule::BridgeObject::CallMethodSync(napi_env env, napi_callbac
     return methodResult->GetOkResult();
 }
 
+napi_value BridgeModule::BridgeObject::SetBatchMode(napi_env env, napi_callback_info info)
+{
+    napi_value thisVal = nullptr;
+    size_t argc = PluginUtilsNApi::MAX_ARG_NUM;
+    napi_value argv[PluginUtilsNApi::MAX_ARG_NUM] = { nullptr };
+    NAPI_CALL(env, napi_get_cb_info(env, info, &argc, argv, &thisVal, nullptr));
+
+    if (argc != PluginUtilsNApi::ARG_NUM_1 ||
+        PluginUtilsNApi::GetValueType(env, argv[PluginUtilsNApi::ARG_NUM_0]) != napi_boolean) {
+        LOGE("BridgeObject::SetBatchMode: Method parameter error.");
+        return PluginUtilsNApi::CreateUndefined(env);
+    }
+
+    Bridge* bridge = GetBridge(env, thisVal);
+    if (bridge == nullptr) {
+        LOGE("BridgeObject::SetBatchMode: Failed to obtain the Bridge object.");
+        return PluginUtilsNApi::CreateUndefined(env);
+    }
+    bridge->SetBatchMode(PluginUtilsNApi::GetBool(env, argv[PluginUtilsNApi::ARG_NUM_0]));
+    return PluginUtilsNApi::CreateUndefined(env);
+}
+
+napi_value BridgeModule::BridgeObject::GetBatchStats(napi_env env, napi_callback_info info)
+{
+    napi_value thisVal = nullptr;
+    size_t argc = PluginUtilsNApi::MAX_ARG_NUM;
+    napi_value argv[PluginUtilsNApi::MAX_ARG_NUM] = { nullptr };
+    NAPI_CALL(env, napi_get_cb_info(env, info, &argc, argv, &thisVal, nullptr));
+
+    Bridge* bridge = GetBridge(env, thisVal);
+    if (bridge == nullptr) {
+        LOGE("BridgeObject::GetBatchStats: Failed to obtain the Bridge object.");
+        return PluginUtilsNApi::CreateUndefined(env);
+    }
+
+    BridgeBatchStats stats = bridge->GetBatchStats();
+    napi_value result = PluginUtilsNApi::CreateObject(env);
+    PluginUtilsNApi::SetNamedProperty(env, result, "batchMode",
+        PluginUtilsNApi::CreateBoolean(env, bridge->GetBatchMode()));
+    SetInt64Property(env, result, "flushCount", static_cast<int64_t>(stats.flushCount));
+    SetInt64Property(env, result, "taskCount", static_cast<int64_t>(stats.taskCount));
+    SetInt64Property(env, result, "lastBatchSize", static_cast<int64_t>(stats.lastBatchSize));
+    SetInt64Property(env, result, "maxBatchSize", static_cast<int64_t>(stats.maxBatchSize));
+    SetInt64Property(env, result, "lastFlushLatency", stats.lastFlushLatency);
+    SetInt64Property(env, result, "maxFlushLatency", stats.maxFlushLatency);
+    SetInt64Property(env, result, "totalFlushLatency", stats.totalFlushLatency);
+    return result;
+}
+
+napi_value BridgeModule::BridgeObject::OpenStream(napi_env env, napi_callback_info info)
+{
+    napi_value thisVal = nullptr;
+    size_t argc = PluginUtilsNApi::MAX_ARG_NUM;
+    napi_value argv[PluginUtilsNApi::MAX_ARG_NUM] = { nullptr };
+    NAPI_CALL(env, napi_get_cb_info(env, info, &argc, argv, &thisVal, nullptr));
+
+    if (argc == PluginUtilsNApi::ARG_NUM_0 || argc > PluginUtilsNApi::ARG_NUM_3 ||
+        PluginUtilsNApi::GetValueType(env, argv[PluginUtilsNApi::ARG_NUM_0]) != napi_string ||
+        (argc > PluginUtilsNApi::ARG_NUM_1 &&
+            PluginUtilsNApi::GetValueType(env, argv[PluginUtilsNApi::ARG_NUM_1]) != napi_number) ||
+        (argc > PluginUtilsNApi::ARG_NUM_2 &&
+            PluginUtilsNApi::GetValueType(env, argv[PluginUtilsNApi::ARG_NUM_2]) != napi_function)) {
+        LOGE("BridgeObject::OpenStream: Method parameter error.");
+        napi_throw(env,
+            NAPIUtils::CreateErrorMessage(env, static_cast<int32_t>(ErrorCode::BRIDGE_METHOD_PARAM_ERROR)));
+        return nullptr;
+    }
+
+    Bridge* bridge = GetBridge(env, thisVal);
+    if (bridge == nullptr) {
+        LOGE("BridgeObject::OpenStream: Failed to obtain the Bridge object.");
+        napi_throw(env, NAPIUtils::CreateErrorMessage(env, static_cast<int32_t>(ErrorCode::BRIDGE_INVALID)));
+        return nullptr;
+    }
+
+    std::string streamName = PluginUtilsNApi::GetStringFromValueUtf8(env, argv[PluginUtilsNApi::ARG_NUM_0]);
+    uint32_t credits = BridgeStreamChannel::DEFAULT_STREAM_CREDITS;
+    if (argc > PluginUtilsNApi::ARG_NUM_1) {
+        int32_t value = PluginUtilsNApi::GetCInt32(argv[PluginUtilsNApi::ARG_NUM_1], env);
+        credits = value > 0 ? static_cast<uint32_t>(value) : BridgeStreamChannel::DEFAULT_STREAM_CREDITS;
+    }
+    std::shared_ptr<BridgeStreamChannel> channel = nullptr;
+    ErrorCode code = bridge->OpenStream(streamName, credits, channel);
+    if (code != ErrorCode::BRIDGE_ERROR_NO) {
+        LOGE("BridgeObject::OpenStream: Open stream %{public}s failed.", streamName.c_str());
+        napi_throw(env, NAPIUtils::CreateErrorMessage(env, static_cast<int32_t>(code)));
+        return nullptr;
+    }
+
+    auto handle = new (std::nothrow) StreamHandle();
+    if (handle == nullptr) {
+        bridge->CloseStream(channel);
+        napi_throw(env, NAPIUtils::CreateErrorMessage(env, static_cast<int32_t>(ErrorCode::BRIDGE_CREATE_ERROR)));
+        return nullptr;
+    }
+    handle->channel = channel;
+    if (argc > PluginUtilsNApi::ARG_NUM_2) {
+        handle->creditCallback = PluginUtilsNApi::CreateReference(env, argv[PluginUtilsNApi::ARG_NUM_2]);
+        napi_ref creditCallback = handle->creditCallback;
+        // Acknowledgements are delivered on the JS thread, the same one that finalizes the handle.
+        channel->SetCreditListener([env, creditCallback](uint32_t credits) {
+            ScopedHandleScope scope(env);
+            napi_value callback = PluginUtilsNApi::GetReference(env, creditCallback);
+            napi_value argv[] = { PluginUtilsNApi::GetNapiInt32(static_cast<int32_t>(credits), env) };
+            PluginUtilsNApi::CallFunction(env, PluginUtilsNApi::CreateUndefined(env), callback,
+                PluginUtilsNApi::ARG_NUM_1, argv);
+        });
+    }
+
+    napi_value stream = PluginUtilsNApi::CreateObject(env);
+    PluginUtilsNApi::SetNamedProperty(env, stream, PROPERTY_STREAM_NAME,
+        PluginUtilsNApi::CreateStringUtf8(env, streamName));
+    napi_status status = napi_wrap(
+        env, stream, reinterpret_cast<void*>(handle),
+        [](napi_env env, void* data, void* hint) {
+            auto handle = reinterpret_cast<StreamHandle*>(data);
+            if (handle->creditCallback != nullptr) {
+                handle->channel->SetCreditListener(nullptr);
+                PluginUtilsNApi::DeleteReference(env, handle->creditCallback);
+            }
+            delete handle;
+        },
+        nullptr, nullptr);
+    if (status != napi_ok) {
+        LOGE("BridgeObject::OpenStream: Failed to wrap the stream object.");
+        channel->SetCreditListener(nullptr);
+        if (handle->creditCallback != nullptr) {
+            PluginUtilsNApi::DeleteReference(env, handle->creditCallback);
+        }
+        delete handle;
+        bridge->CloseStream(channel);
+        napi_throw(env, NAPIUtils::CreateErrorMessage(env, static_cast<int32_t>(ErrorCode::BRIDGE_CREATE_ERROR)));
+        return nullptr;
+    }
+    return stream;
+}
+
+napi_value BridgeModule::BridgeObject::WriteStream(napi_env env, napi_callback_info info)
+{
+    napi_value thisVal = nullptr;
+    size_t argc = PluginUtilsNApi::MAX_ARG_NUM;
+    napi_value argv[PluginUtilsNApi::MAX_ARG_NUM] = { nullptr };
+    NAPI_CALL(env, napi_get_cb_info(env, info, &argc, argv, &thisVal, nullptr));
+
+    void* data = nullptr;
+    size_t size = 0;
+    auto channel = (argc == PluginUtilsNApi::ARG_NUM_2) ?
+        GetStreamChannel(env, argv[PluginUtilsNApi::ARG_NUM_0]) : nullptr;
+    if (channel == nullptr || !PluginUtilsNApi::IsArrayBuffer(env, argv[PluginUtilsNApi::ARG_NUM_1]) ||
+        napi_get_arraybuffer_info(env, argv[PluginUtilsNApi::ARG_NUM_1], &data, &size) != napi_ok) {
+        LOGE("BridgeObject::WriteStream: Method parameter error.");
+        napi_throw(env,
+            NAPIUtils::CreateErrorMessage(env, static_cast<int32_t>(ErrorCode::BRIDGE_METHOD_PARAM_ERROR)));
+        return nullptr;
+    }
+
+    Bridge* bridge = GetBridge(env, thisVal);
+    if (bridge == nullptr) {
+        LOGE("BridgeObject::WriteStream: Failed to obtain the Bridge object.");
+        napi_throw(env, NAPIUtils::CreateErrorMessage(env, static_cast<int32_t>(ErrorCode::BRIDGE_INVALID)));
+        return nullptr;
+    }
+
+    // Running out of credits is back-pressure, not an error: the caller retries once credits come back.
+    ErrorCode code = bridge->WriteStream(channel, reinterpret_cast<const uint8_t*>(data), size);
+    if (code == ErrorCode::BRIDGE_STREAM_NO_CREDIT) {
+        return PluginUtilsNApi::CreateBoolean(env, false);
+    }
+    if (code != ErrorCode::BRIDGE_ERROR_NO) {
+        LOGE("BridgeObject::WriteStream: Write stream %{public}s failed.", channel->GetStreamName().c_str());
+        napi_throw(env, NAPIUtils::CreateErrorMessage(env, static_cast<int32_t>(code)));
+        return nullptr;
+    }
+    return PluginUtilsNApi::CreateBoolean(env, true);
+}
+
+napi_value BridgeModule::BridgeObject::CloseStream(napi_env env, napi_callback_info info)
+{
+    napi_value thisVal = nullptr;
+    size_t argc = PluginUtilsNApi::MAX_ARG_NUM;
+    napi_value argv[PluginUtilsNApi::MAX_ARG_NUM] = { nullptr };
+    NAPI_CALL(env, napi_get_cb_info(env, info, &argc, argv, &thisVal, nullptr));
+
+    auto channel = (argc == PluginUtilsNApi::ARG_NUM_1) ?
+        GetStreamChannel(env, argv[PluginUtilsNApi::ARG_NUM_0]) : nullptr;
+    if (channel == nullptr) {
+        LOGE("BridgeObject::CloseStream: Method parameter error.");
+        napi_throw(env,
+            NAPIUtils::CreateErrorMessage(env, static_cast<int32_t>(ErrorCode::BRIDGE_METHOD_PARAM_ERROR)));
+        return nullptr;
+    }
+
+    Bridge* bridge = GetBridge(env, thisVal);
+    if (bridge == nullptr) {
+        LOGE("BridgeObject::CloseStream: Failed to obtain the Bridge object.");
+        napi_throw(env, NAPIUtils::CreateErrorMessage(env, static_cast<int32_t>(ErrorCode::BRIDGE_INVALID)));
+        return nullptr;
+    }
+
+    ErrorCode code = bridge->CloseStream(channel);
+    if (code != ErrorCode::BRIDGE_ERROR_NO) {
+        LOGE("BridgeObject::CloseStream: Close stream %{public}s failed.", channel->GetStreamName().c_str());
+        napi_throw(env, NAPIUtils::CreateErrorMessage(env, static_cast<int32_t>(code)));
+        return nullptr;
+    }
+    return PluginUtilsNApi::CreateUndefined(env);
+}
+
+napi_value BridgeModule::BridgeObject::SetMetricsEnabled(napi_env env, napi_callback_info info)
+{
+    napi_value thisVal = nullptr;
+    size_t argc = PluginUtilsNApi::MAX_ARG_NUM;
+    napi_value argv[PluginUtilsNApi::MAX_ARG_NUM] = { nullptr };
+    NAPI_CALL(env, napi_get_cb_info(env, info, &argc, argv, &thisVal, nullptr));
+
+    if (argc != PluginUtilsNApi::ARG_NUM_1 ||
+        PluginUtilsNApi::GetValueType(env, argv[PluginUtilsNApi::ARG_NUM_0]) != napi_boolean) {
+        LOGE("BridgeObject::SetMetricsEnabled: Method parameter error.");
+        return PluginUtilsNApi::CreateUndefined(env);
+    }
+
+    Bridge* bridge = GetBridge(env, thisVal);
+    if (bridge == nullptr) {
+        LOGE("BridgeObject::SetMetricsEnabled: Failed to obtain the Bridge object.");
+        return PluginUtilsNApi::CreateUndefined(env);
+    }
+    bridge->SetMetricsEnabled(PluginUtilsNApi::GetBool(env, argv[PluginUtilsNApi::ARG_NUM_0]));
+    return PluginUtilsNApi::CreateUndefined(env);
+}
+
+napi_value BridgeModule::BridgeObject::GetMethodStats(napi_env env, napi_callback_info info)
+{
+    napi_value thisVal = nullptr;
+    size_t argc = PluginUtilsNApi::MAX_ARG_NUM;
+    napi_value argv[PluginUtilsNApi::MAX_ARG_NUM] = { nullptr };
+    NAPI_CALL(env, napi_get_cb_info(env, info, &argc, argv, &thisVal, nullptr));
+
+    Bridge* bridge = GetBridge(env, thisVal);
+    if (bridge == nullptr) {
+        LOGE("BridgeObject::GetMethodStats: Failed to obtain the Bridge object.");
+        return PluginUtilsNApi::CreateUndefined(env);
+    }
+
+    napi_value result = PluginUtilsNApi::CreateArray(env);
+    int index = 0;
+    for (const auto& stats : bridge->GetMethodStats()) {
+        napi_value item = PluginUtilsNApi::CreateObject(env);
+        PluginUtilsNApi::SetNamedProperty(env, item, "methodName",
+            PluginUtilsNApi::CreateStringUtf8(env, stats.methodName));
+        SetInt64Property(env, item, "callCount", static_cast<int64_t>(stats.callCount));
+        SetInt64Property(env, item, "inFlightCount", static_cast<int64_t>(stats.inFlightCount));
+        SetInt64Property(env, item, "p50Latency", stats.p50Latency);
+        SetInt64Property(env, item, "p95Latency", stats.p95Latency);
+        SetInt64Property(env, item, "p99Latency", stats.p99Latency);
+        SetInt64Property(env, item, "maxLatency", stats.maxLatency);
+        SetInt64Property(env, item, "totalRequestBytes", static_cast<int64_t>(stats.totalRequestBytes));
+        SetInt64Property(env, item, "totalResponseBytes", static_cast<int64_t>(stats.totalResponseBytes));
+        SetInt64Property(env, item, "maxRequestBytes", static_cast<int64_t>(stats.maxRequestBytes));
+        SetInt64Property(env, item, "maxResponseBytes", static_cast<int64_t>(stats.maxResponseBytes));
+        PluginUtilsNApi::SetSelementToArray(env, result, index++, item);
+    }
+    return result;
+}
+
+napi_value BridgeModule::BridgeObject::SetMetricsTraceListener(napi_env env, napi_callback_info info)
+{
+    napi_value thisVal = nullptr;
+    size_t argc = PluginUtilsNApi::MAX_ARG_NUM;
+    napi_value argv[PluginUtilsNApi::MAX_ARG_NUM] = { nullptr };
+    NAPI_CALL(env, napi_get_cb_info(env, info, &argc, argv, &thisVal, nullptr));
+
+    napi_valuetype type = (argc == PluginUtilsNApi::ARG_NUM_1) ?
+        PluginUtilsNApi::GetValueType(env, argv[PluginUtilsNApi::ARG_NUM_0]) : napi_undefined;
+    if (argc > PluginUtilsNApi::ARG_NUM_1 || (type != napi_function && type != napi_null && type != napi_undefined)) {
+        LOGE("BridgeObject::SetMetricsTraceListener: Method parameter error.");
+        return PluginUtilsNApi::CreateUndefined(env);
+    }
+
+    Bridge* bridge = GetBridge(env, thisVal);
+    if (bridge == nullptr) {
+        LOGE("BridgeObject::SetMetricsTraceListener: Failed to obtain the Bridge object.");
+        return PluginUtilsNApi::CreateUndefined(env);
+    }
+
+    // Passing null or nothing removes the listener.
+    if (type != napi_function) {
+        bridge->SetMetricsTraceListener(nullptr);
+        return PluginUtilsNApi::CreateUndefined(env);
+    }
+    auto callback = std::make_shared<TraceCallback>(env,
+        PluginUtilsNApi::CreateReference(env, argv[PluginUtilsNApi::ARG_NUM_0]));
+    bridge->SetMetricsTraceListener([callback](const std::string& methodName, int64_t startTime, int64_t endTime) {
+        callback->Post(methodName, startTime, endTime);
+    });
+    return PluginUtilsNApi::CreateUndefined(env);
+}
+
+napi_value BridgeModule::BridgeObject::RegisterStream(napi_env env, napi_callback_info info)
+{
+    napi_value thisVal = nullptr;
+    size_t argc = PluginUtilsNApi::MAX_ARG_NUM;
+    napi_value argv[PluginUtilsNApi::MAX_ARG_NUM] = { nullptr };
+    NAPI_CALL(env, napi_get_cb_info(env, info, &argc, argv, &thisVal, nullptr));
+
+    if (argc < PluginUtilsNApi::ARG_NUM_2 || argc > PluginUtilsNApi::ARG_NUM_3 ||
+        PluginUtilsNApi::GetValueType(env, argv[PluginUtilsNApi::ARG_NUM_0]) != napi_string ||
+        PluginUtilsNApi::GetValueType(env, argv[PluginUtilsNApi::ARG_NUM_1]) != napi_function ||
+        (argc > PluginUtilsNApi::ARG_NUM_2 &&
+            PluginUtilsNApi::GetValueType(env, argv[PluginUtilsNApi::ARG_NUM_2]) != napi_function)) {
+        LOGE("BridgeObject::RegisterStream: Method parameter error.");
+        napi_throw(env,
+            NAPIUtils::CreateErrorMessage(env, static_cast<int32_t>(ErrorCode::BRIDGE_METHOD_PARAM_ERROR)));
+        return nullptr;
+    }
+
+    Bridge* bridge = GetBridge(env, thisVal);
+    if (bridge == nullptr) {
+        LOGE("BridgeObject::RegisterStream: Failed to obtain the Bridge object.");
+        napi_throw(env, NAPIUtils::CreateErrorMessage(env, static_cast<int32_t>(ErrorCode::BRIDGE_INVALID)));
+        return nullptr;
+    }
+
+    auto refs = new (std::nothrow) StreamReceiverRefs();
+    if (refs == nullptr) {
+        napi_throw(env, NAPIUtils::CreateErrorMessage(env, static_cast<int32_t>(ErrorCode::BRIDGE_CREATE_ERROR)));
+        return nullptr;
+    }
+    refs->dataCallback = PluginUtilsNApi::CreateReference(env, argv[PluginUtilsNApi::ARG_NUM_1]);
+    if (argc > PluginUtilsNApi::ARG_NUM_2) {
+        refs->closeCallback = PluginUtilsNApi::CreateReference(env, argv[PluginUtilsNApi::ARG_NUM_2]);
+    }
+    // Frames are delivered and the receiver is detached on the JS thread, so the references stay valid
+    // for every frame the listener sees.
+    auto frameListener = [env, refs](StreamFrameType type, const uint8_t* data, size_t size) {
+        ScopedHandleScope scope(env);
+        if (type == StreamFrameType::STREAM_DATA) {
+            napi_value argv[] = { PluginUtilsNApi::CreateArrayBuffer(env, data, size) };
+            PluginUtilsNApi::CallFunction(env, PluginUtilsNApi::CreateUndefined(env),
+                PluginUtilsNApi::GetReference(env, refs->dataCallback), PluginUtilsNApi::ARG_NUM_1, argv);
+        } else if (type == StreamFrameType::STREAM_CLOSE && refs->closeCallback != nullptr) {
+            PluginUtilsNApi::CallFunction(env, PluginUtilsNApi::CreateUndefined(env),
+                PluginUtilsNApi::GetReference(env, refs->closeCallback), PluginUtilsNApi::ARG_NUM_0, nullptr);
+        }
+    };
+    auto detachListener = [env, refs]() {
+        PluginUtilsNApi::DeleteReference(env, refs->dataCallback);
+        if (refs->closeCallback != nullptr) {
+            PluginUtilsNApi::DeleteReference(env, refs->closeCallback);
+        }
+        delete refs;
+    };
+    std::string streamName = PluginUtilsNApi::GetStringFromValueUtf8(env, argv[PluginUtilsNApi::ARG_NUM_0]);
+    auto receiver = std::make_shared<BridgeStreamReceiver>(streamName, frameListener, detachListener);
+    ErrorCode code = bridge->RegisterStreamReceiver(receiver);
+    if (code != ErrorCode::BRIDGE_ERROR_NO) {
+        LOGE("BridgeObject::RegisterStream: Register stream %{public}s failed.", streamName.c_str());
+        receiver->Detach();
+        napi_throw(env, NAPIUtils::CreateErrorMessage(env, static_cast<int32_t>(code)));
+        return nullptr;
+    }
+    return PluginUtilsNApi::CreateUndefined(env);
+}
+
+napi_value BridgeModule::BridgeObject::UnRegisterStream(napi_env env, napi_callback_info info)
+{
+    napi_value thisVal = nullptr;
+    size_t argc = PluginUtilsNApi::MAX_ARG_NUM;
+    napi_value argv[PluginUtilsNApi::MAX_ARG_NUM] = { nullptr };
+    NAPI_CALL(env, napi_get_cb_info(env, info, &argc, argv, &thisVal, nullptr));
+
+    if (argc != PluginUtilsNApi::ARG_NUM_1 ||
+        PluginUtilsNApi::GetValueType(env, argv[PluginUtilsNApi::ARG_NUM_0]) != napi_string) {
+        LOGE("BridgeObject::UnRegisterStream: Method parameter error.");
+        napi_throw(env,
+            NAPIUtils::CreateErrorMessage(env, static_cast<int32_t>(ErrorCode::BRIDGE_METHOD_PARAM_ERROR)));
+        return nullptr;
+    }
+
+    Bridge* bridge = GetBridge(env, thisVal);
+    if (bridge == nullptr) {
+        LOGE("BridgeObject::UnRegisterStream: Failed to obtain the Bridge object.");
+        napi_throw(env, NAPIUtils::CreateErrorMessage(env, static_cast<int32_t>(ErrorCode::BRIDGE_INVALID)));
+        return nullptr;
+    }
+
+    std::string streamName = PluginUtilsNApi::GetStringFromValueUtf8(env, argv[PluginUtilsNApi::ARG_NUM_0]);
+    ErrorCode code = bridge->UnRegisterStreamReceiver(streamName);
+    if (code != ErrorCode::BRIDGE_ERROR_NO) {
+        LOGE("BridgeObject::UnRegisterStream: Unregister stream %{public}s failed.", streamName.c_str());
+        napi_throw(env, NAPIUtils::CreateErrorMessage(env, static_cast<int32_t>(code)));
+        return nullptr;
+    }
+    return PluginUtilsNApi::CreateUndefined(env);
+}
+
+std::shared_ptr<BridgeStreamChannel> BridgeModule::GetStreamChannel(napi_env env, napi_value stream)
+{
+    if (PluginUtilsNApi::GetValueType(env, stream) != napi_object) {
+        return nullptr;
+    }
+    StreamHandle* handle = nullptr;
+    if (napi_unwrap(env, stream, reinterpret_cast<void**>(&handle)) != napi_ok || handle == nullptr) {
+        return nullptr;
+    }
+    return handle->channel;
+}
+
+void BridgeModule::SetInt64Property(napi_env env, napi_value object, const std::string& name, int64_t value)
+{
+    napi_value number = nullptr;
+    if (napi_create_int64(env, value, &number) == napi_ok) {
+        PluginUtilsNApi::SetNamedProperty(env, object, name, number);
+    }
+}
+
 static napi_module BridgeModule = {
     .nm_version = 1,
     .nm_flags = 0,
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bridge_stream_channel.h"
+
+#include <cinttypes>
+
+#include "bridge_binary_codec.h"
+#include "bridge_binary_marshaller.h"
+#include "bridge_packager.h"
+#include "log.h"
+
+namespace OHOS::Plugin::Bridge {
+namespace {
+constexpr size_t STREAM_FRAME_FIELDS = 3;
+constexpr size_t STREAM_FRAME_TYPE = 0;
+constexpr size_t STREAM_FRAME_SEQUENCE = 1;
+constexpr size_t STREAM_FRAME_PAYLOAD = 2;
+} // namespace
+
+BridgeStreamChannel::BridgeStreamChannel(const std::string& streamName, uint32_t credits)
+    : streamName_(streamName), credits_(credits == 0 ? DEFAULT_STREAM_CREDITS : credits)
+{
+}
+
+uint32_t BridgeStreamChannel::GetCredits(void)
+{
+    std::lock_guard<std::mutex> lock(lock_);
+    return credits_;
+}
+
+bool BridgeStreamChannel::IsClosed(void)
+{
+    std::lock_guard<std::mutex> lock(lock_);
+    return closed_;
+}
+
+void BridgeStreamChannel::SetCreditListener(const CreditListener& listener)
+{
+    std::lock_guard<std::mutex> lock(lock_);
+    creditListener_ = listener;
+}
+
+ErrorCode BridgeStreamChannel::TakeFrame(
+    StreamFrameType type, const uint8_t* data, size_t size, std::vector<uint8_t>& frame)
+{
+    if (data == nullptr && size > 0) {
+        LOGE("TakeFrame: The data is null.");
+        return ErrorCode::BRIDGE_DATA_ERROR;
+    }
+    int64_t sequence = 0;
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        if (closed_) {
+            LOGE("TakeFrame: The stream %{public}s is closed.", streamName_.c_str());
+            return ErrorCode::BRIDGE_STREAM_CLOSED;
+        }
+        // CLOSE needs no credit, so a stream can always be closed while its data frames are in flight.
+        if (type == StreamFrameType::STREAM_CLOSE) {
+            closed_ = true;
+        } else if (credits_ == 0) {
+            return ErrorCode::BRIDGE_STREAM_NO_CREDIT;
+        } else {
+            credits_--;
+        }
+        sequence = sequence_++;
+    }
+    EncodeFrame(type, sequence, data, size, frame);
+    return ErrorCode::BRIDGE_ERROR_NO;
+}
+
+void BridgeStreamChannel::OnFrameAcked(int errorCode)
+{
+    CreditListener listener;
+    uint32_t credits = 0;
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        if (!closed_) {
+            credits_++;
+        }
+        if (errorCode != 0) {
+            LOGE("OnFrameAcked: The stream %{public}s failed, errorCode = %{public}d.",
+                streamName_.c_str(), errorCode);
+            closed_ = true;
+        }
+        credits = credits_;
+        listener = creditListener_;
+    }
+    if (listener) {
+        listener(credits);
+    }
+}
+
+void BridgeStreamChannel::EncodeFrame(StreamFrameType type, int64_t sequence,
+    const uint8_t* data, size_t size, std::vector<uint8_t>& frame)
+{
+    CodecableValue typeValue(static_cast<int32_t>(type));
+    CodecableValue sequenceValue(sequence);
+    size_t frameSize = BridgePackager::ComputeSizeEnd(STREAM_FRAME_FIELDS, BridgeBinaryMarshaller::MARSHALL_SIZE_1);
+    frameSize = BridgePackager::ComputeEncodedEnd(typeValue, frameSize);
+    frameSize = BridgePackager::ComputeEncodedEnd(sequenceValue, frameSize);
+    frameSize = BridgePackager::ComputeSizeEnd(size, frameSize + BridgeBinaryMarshaller::MARSHALL_SIZE_1) + size;
+
+    // The payload is written straight from the caller's buffer instead of going through a CodecableValue copy.
+    frame.clear();
+    frame.reserve(frameSize);
+    BridgeBinaryMarshaller marshaller(&frame);
+    marshaller.MarshallingByte(static_cast<uint8_t>(CodecableIndex::I_COMPOSITE_LIST));
+    BridgePackager::MarshallingSize(STREAM_FRAME_FIELDS, &marshaller);
+    BridgePackager::Marshalling(typeValue, &marshaller);
+    BridgePackager::Marshalling(sequenceValue, &marshaller);
+    marshaller.MarshallingByte(static_cast<uint8_t>(CodecableIndex::I_LIST_UINT8));
+    BridgePackager::MarshallingSize(size, &marshaller);
+    if (size > 0) {
+        marshaller.MarshallingBytes(data, size);
+    }
+}
+
+bool BridgeStreamChannel::DecodeFrame(const uint8_t* frame, size_t frameSize, StreamFrameType& type,
+    int64_t& sequence, const uint8_t*& data, size_t& size)
+{
+    if (frame == nullptr || frameSize == 0) {
+        return false;
+    }
+    auto decoded = BridgeBinaryCodec::GetInstance().DecodeBufferView(frame, frameSize);
+    auto fields = decoded ? std::get_if<CodecableViewList>(decoded.get()) : nullptr;
+    if (fields == nullptr || fields->size() != STREAM_FRAME_FIELDS) {
+        return false;
+    }
+    auto typeValue = std::get_if<int32_t>(&(*fields)[STREAM_FRAME_TYPE]);
+    auto payload = std::get_if<CodecableSpan<uint8_t>>(&(*fields)[STREAM_FRAME_PAYLOAD]);
+    const auto& sequenceView = (*fields)[STREAM_FRAME_SEQUENCE];
+    if (typeValue == nullptr || payload == nullptr || *typeValue < static_cast<int32_t>(StreamFrameType::STREAM_OPEN) ||
+        *typeValue > static_cast<int32_t>(StreamFrameType::STREAM_CLOSE)) {
+        return false;
+    }
+    // Small sequence numbers may be encoded as int32 by the platform encoder.
+    if (auto value32 = std::get_if<int32_t>(&sequenceView)) {
+        sequence = *value32;
+    } else if (auto value64 = std::get_if<int64_t>(&sequenceView)) {
+        sequence = *value64;
+    } else {
+        return false;
+    }
+    type = static_cast<StreamFrameType>(*typeValue);
+    data = payload->Bytes();
+    size = payload->Size();
+    return true;
+}
+
+BridgeStreamReceiver::BridgeStreamReceiver(const std::string& streamName, const FrameListener& frameListener,
+    const DetachListener& detachListener)
+    : streamName_(streamName), frameListener_(frameListener), detachListener_(detachListener)
+{
+}
+
+ErrorCode BridgeStreamReceiver::OnFrame(const uint8_t* frame, size_t size)
+{
+    StreamFrameType type = StreamFrameType::STREAM_DATA;
+    int64_t sequence = 0;
+    const uint8_t* data = nullptr;
+    size_t dataSize = 0;
+    if (!BridgeStreamChannel::DecodeFrame(frame, size, type, sequence, data, dataSize)) {
+        LOGE("OnFrame: The frame of stream %{public}s is malformed.", streamName_.c_str());
+        return ErrorCode::BRIDGE_DATA_ERROR;
+    }
+
+    FrameListener listener;
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        if (!frameListener_) {
+            return ErrorCode::BRIDGE_STREAM_CLOSED;
+        }
+        if (type == StreamFrameType::STREAM_OPEN) {
+            nextSequence_ = sequence;
+            opened_ = true;
+        } else if (!opened_) {
+            return ErrorCode::BRIDGE_STREAM_CLOSED;
+        }
+        if (sequence != nextSequence_) {
+            LOGE("OnFrame: The stream %{public}s expects frame %{public}" PRId64 ", got %{public}" PRId64 ".",
+                streamName_.c_str(), nextSequence_, sequence);
+            return ErrorCode::BRIDGE_DATA_ERROR;
+        }
+        nextSequence_++;
+        opened_ = (type != StreamFrameType::STREAM_CLOSE);
+        listener = frameListener_;
+    }
+    listener(type, data, dataSize);
+    return ErrorCode::BRIDGE_ERROR_NO;
+}
+
+void BridgeStreamReceiver::Detach(void)
+{
+    DetachListener listener;
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        frameListener_ = nullptr;
+        listener.swap(detachListener_);
+    }
+    if (listener) {
+        listener();
+    }
+}
+} // namespace OHOS::Plugin::Bridge
@@ -107,14 +107,6 @@ int64_t MethodData::GetStartTime(void) const
     return startTime_;
 }
 
-int64_t MethodData::GetSystemTime(void)
-{
-    auto curNow = std::chrono::system_clock::now();
-    std::chrono::milliseconds milliSec =
-        std::chrono::duration_cast<std::chrono::milliseconds>(curNow.time_since_epoch());
-    return milliSec.count();
-}
-
 NAPIAsyncEvent* MethodData::GetAsyncEvent(void) const
 {
     return asyncEvent_;
@@ -599,7 +591,7 @@ void MethodData::PlatformCallMethodBinary(std::unique_ptr<Ace::Platform::BufferM
         auto dataBuffer = event->GetMethodParameter();
 
         Ace::Platform::BufferMapping mapping(std::get<uint8_t*>(dataBuffer), std::get<size_t>(dataBuffer));
-        auto decoded = BridgeBinaryCodec::GetInstance().DecodeBuffer(mapping.GetMapping(), mapping.GetSize());
+        auto decoded = BridgeBinaryCodec::GetInstance().DecodeBufferView(mapping.GetMapping(), mapping.GetSize());
         MethodDataConverter::ConvertToNapiValues(env, *decoded, argc, argv);
 
         event->AsyncWorkCallMethod(argc, argv);
@@ -639,7 +631,7 @@ void MethodData::PlatformSendMessageBinary(std::unique_ptr<Ace::Platform::Buffer
         return;
     }
 
-    auto decoded = BridgeBinaryCodec::GetInstance().DecodeBuffer(data->GetMapping(), data->GetSize());
+    auto decoded = BridgeBinaryCodec::GetInstance().DecodeBufferView(data->GetMapping(), data->GetSize());
     napi_value binaryResult = MethodDataConverter::ConvertToNapiValue(env_, *decoded);
     asyncEvent_->SetRefData(binaryResult);
     asyncEvent_->SetBridgeName(bridgeName_);
@@ -713,6 +705,14 @@ MethodResult MethodData::PlatformCallMethodSync(const std::string& parameter)
 }
 
 MethodResult MethodData::PlatformCallMethodSyncBinary(std::unique_ptr<Ace::Platform::BufferMapping> parameter)
+{
+    if (!parameter) {
+        return PlatformCallMethodSyncBinary(nullptr, 0);
+    }
+    return PlatformCallMethodSyncBinary(parameter->GetMapping(), parameter->GetSize());
+}
+
+MethodResult MethodData::PlatformCallMethodSyncBinary(const uint8_t* data, size_t size)
 {
     ScopedHandleScope scope(env_);
     LOGD("MethodData::PlatformCallMethodSyncBinary called for method '%{public}s'", methodName_.c_str());
@@ -733,13 +733,7 @@ MethodResult MethodData::PlatformCallMethodSyncBinary(std::unique_ptr<Ace::Platf
         return result;
     }
 
-    uint8_t* dataPtr = nullptr;
-    size_t dataSize = 0;
-    if (parameter) {
-        dataPtr = const_cast<uint8_t*>(parameter->GetMapping());
-        dataSize = parameter->GetSize();
-    }
-    napi_value methodResultValue = asyncEvent_->AsyncWorkCallMethodSyncBinary(dataPtr, dataSize);
+    napi_value methodResultValue = asyncEvent_->AsyncWorkCallMethodSyncBinary(data, size);
     if (methodResultValue != nullptr) {
         result.ParseJSMethodResultBinary(env_, methodResultValue);
     } else {
@@ -19,6 +19,7 @@
 #include <cmath>
 #include <cinttypes>
 #include <cstdint>
+#include <type_traits>
 
 #include "log.h"
 #include "plugins/interfaces/native/inner_api/plugin_utils_napi.h"
@@ -228,6 +229,111 @@ void MethodDataConverter::ConvertToNapiValues(napi_env env, const CodecableValue
     argc = argNum;
 }
 
+napi_value MethodDataConverter::ConvertToNapiValue(napi_env env, const CodecableView& value)
+{
+    switch (value.GetType()) {
+        case CodecableType::T_BOOL:
+            return PluginUtilsNApi::CreateBoolean(env, std::get<bool>(value));
+        case CodecableType::T_INT32:
+            return PluginUtilsNApi::CreateInt32(env, std::get<int32_t>(value));
+        case CodecableType::T_INT64: {
+            int64_t temp = std::get<int64_t>(value);
+            return PluginUtilsNApi::CreateDouble(env, static_cast<double>(temp));
+        }
+        case CodecableType::T_DOUBLE:
+            return PluginUtilsNApi::CreateDouble(env, std::get<double>(value));
+        case CodecableType::T_STRING:
+            return CreateStringViewValue(env, std::get<std::string_view>(value));
+        case CodecableType::T_LIST_UINT8: {
+            const auto& span = std::get<CodecableSpan<uint8_t>>(value);
+            return PluginUtilsNApi::CreateArrayBuffer(env, span.Bytes(), span.Size());
+        }
+        case CodecableType::T_LIST_BOOL:
+            return CreateListSpanValue(env, std::get<CodecableSpan<bool>>(value));
+        case CodecableType::T_LIST_INT32:
+            return CreateListSpanValue(env, std::get<CodecableSpan<int32_t>>(value));
+        case CodecableType::T_LIST_INT64:
+            return CreateListSpanValue(env, std::get<CodecableSpan<int64_t>>(value));
+        case CodecableType::T_LIST_DOUBLE:
+            return CreateListSpanValue(env, std::get<CodecableSpan<double>>(value));
+        case CodecableType::T_LIST_STRING:
+            return CreateListStringViewValue(env, value);
+        case CodecableType::T_MAP:
+            return CreateMapViewValue(env, value);
+        default:
+            return PluginUtilsNApi::CreateNull(env);
+    }
+}
+
+void MethodDataConverter::ConvertToNapiValues(napi_env env, const CodecableView& value, size_t& argc, napi_value* argv)
+{
+    size_t argNum = 0;
+    if (!std::holds_alternative<CodecableViewList>(value)) {
+        return;
+    }
+    const auto& list = std::get<CodecableViewList>(value);
+    for (const auto& item : list) {
+        argv[argNum] = ConvertToNapiValue(env, item);
+        argNum++;
+        if (argNum >= argc) {
+            break;
+        }
+    }
+    argc = argNum;
+}
+
+napi_value MethodDataConverter::CreateStringViewValue(napi_env env, std::string_view value)
+{
+    napi_value result = nullptr;
+    napi_create_string_utf8(env, value.data(), value.size(), &result);
+    return result;
+}
+
+template <typename T>
+napi_value MethodDataConverter::CreateListSpanValue(napi_env env, const CodecableSpan<T>& span)
+{
+    napi_value result = PluginUtilsNApi::CreateArray(env);
+    for (size_t i = 0; i < span.Size(); i++) {
+        napi_value itemValue = nullptr;
+        if constexpr (std::is_same_v<T, bool>) {
+            itemValue = PluginUtilsNApi::CreateBoolean(env, span.At(i));
+        } else if constexpr (std::is_same_v<T, int32_t>) {
+            itemValue = PluginUtilsNApi::CreateInt32(env, span.At(i));
+        } else {
+            itemValue = PluginUtilsNApi::CreateDouble(env, static_cast<double>(span.At(i)));
+        }
+        PluginUtilsNApi::SetSelementToArray(env, result, static_cast<int>(i), itemValue);
+    }
+    return result;
+}
+
+napi_value MethodDataConverter::CreateListStringViewValue(napi_env env, const CodecableView& value)
+{
+    napi_value result = PluginUtilsNApi::CreateArray(env);
+    const auto& vector = std::get<std::vector<std::string_view>>(value);
+    int32_t i = 0;
+    for (const auto& item : vector) {
+        PluginUtilsNApi::SetSelementToArray(env, result, i, CreateStringViewValue(env, item));
+        i++;
+    }
+    return result;
+}
+
+napi_value MethodDataConverter::CreateMapViewValue(napi_env env, const CodecableView& value)
+{
+    napi_value result = PluginUtilsNApi::CreateObject(env);
+    const auto& map = std::get<CodecableViewMap>(value);
+    for (const auto& pair : map) {
+        if (!std::holds_alternative<std::string_view>(pair.first)) {
+            LOGW("CreateMapViewValue: skip the non-string key.");
+            continue;
+        }
+        PluginUtilsNApi::SetNamedProperty(env, result,
+            std::string(std::get<std::string_view>(pair.first)), ConvertToNapiValue(env, pair.second));
+    }
+    return result;
+}
+
 CodecableValue MethodDataConverter::GainListValue(napi_env env, napi_value value)
 {
     uint32_t length = 0;
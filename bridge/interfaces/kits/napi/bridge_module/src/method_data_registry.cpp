@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "method_data_registry.h"
+
+#include <functional>
+
+namespace OHOS::Plugin::Bridge {
+std::shared_ptr<MethodData> MethodDataRegistry::Find(const std::string& methodName)
+{
+    Stripe& stripe = GetStripe(methodName);
+    std::lock_guard<std::mutex> lock(stripe.lock);
+    auto iter = stripe.methods.find(methodName);
+    if (iter != stripe.methods.end()) {
+        return iter->second;
+    }
+    return nullptr;
+}
+
+std::shared_ptr<MethodData> MethodDataRegistry::Insert(const std::string& methodName,
+    const std::shared_ptr<MethodData>& methodData)
+{
+    Stripe& stripe = GetStripe(methodName);
+    std::lock_guard<std::mutex> lock(stripe.lock);
+    std::shared_ptr<MethodData>& slot = stripe.methods[methodName];
+    std::shared_ptr<MethodData> replaced = std::move(slot);
+    slot = methodData;
+    return replaced;
+}
+
+bool MethodDataRegistry::InsertIfAbsent(const std::string& methodName, const std::shared_ptr<MethodData>& methodData)
+{
+    Stripe& stripe = GetStripe(methodName);
+    std::lock_guard<std::mutex> lock(stripe.lock);
+    return stripe.methods.emplace(methodName, methodData).second;
+}
+
+bool MethodDataRegistry::Erase(const std::string& methodName)
+{
+    Stripe& stripe = GetStripe(methodName);
+    std::lock_guard<std::mutex> lock(stripe.lock);
+    return stripe.methods.erase(methodName) > 0;
+}
+
+std::vector<std::string> MethodDataRegistry::Clear(void)
+{
+    std::vector<std::string> methodNames;
+    for (auto& stripe : stripes_) {
+        std::lock_guard<std::mutex> lock(stripe.lock);
+        for (const auto& [methodName, methodData] : stripe.methods) {
+            methodNames.push_back(methodName);
+        }
+        stripe.methods.clear();
+    }
+    return methodNames;
+}
+
+MethodDataRegistry::Stripe& MethodDataRegistry::GetStripe(const std::string& methodName)
+{
+    return stripes_[std::hash<std::string> {}(methodName) % STRIPE_COUNT];
+}
+} // namespace OHOS::Plugin::Bridge
@@ -140,7 +140,8 @@ void MethodResult::ParsePlatformMethodResultBinary(napi_env env, int errorCode,
     okResult_ = nullptr;
     CreateErrorObject(env);
     if (errorCode_ == 0) {
-        auto decoded = BridgeBinaryCodec::GetInstance().DecodeBuffer(resultData->GetMapping(), resultData->GetSize());
+        auto decoded = BridgeBinaryCodec::GetInstance().DecodeBufferView(
+            resultData->GetMapping(), resultData->GetSize());
         okResult_ = MethodDataConverter::ConvertToNapiValue(env, *decoded);
     } else {
         napi_get_null(env, &okResult_);
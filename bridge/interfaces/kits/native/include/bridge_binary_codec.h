@@ -20,6 +20,7 @@
 
 #include "bridge_base_codec.h"
 #include "codecable_value.h"
+#include "codecable_view.h"
 
 namespace OHOS::Plugin::Bridge {
 class BridgeBinaryCodec final: public BridgeBaseCodec<CodecableValue, std::vector<uint8_t>> {
@@ -33,7 +34,11 @@ public:
     BridgeBinaryCodec& operator=(BridgeBinaryCodec const&) = delete;
 
     std::unique_ptr<CodecableValue> DecodeBuffer(const uint8_t* dataPtr, size_t size) const;
+    // The returned view borrows from dataPtr, which must outlive it.
+    std::unique_ptr<CodecableView> DecodeBufferView(const uint8_t* dataPtr, size_t size) const;
     std::vector<uint8_t>* EncodeBuffer(const CodecableValue& data) const;
+    // Returns the number of bytes written, or 0 if capacity is below BridgePackager::ComputeEncodedSize(data).
+    size_t EncodeBuffer(const CodecableValue& data, uint8_t* buffer, size_t capacity) const;
 
 private:
     virtual std::unique_ptr<std::vector<uint8_t>> EncodeInner(const CodecableValue& data) const override;
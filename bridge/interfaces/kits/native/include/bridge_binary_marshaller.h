@@ -22,11 +22,14 @@
 #include <vector>
 
 #include "log.h"
+#include "securec.h"
 
 namespace OHOS::Plugin::Bridge {
 class BridgeBinaryMarshaller {
 public:
     explicit BridgeBinaryMarshaller(std::vector<uint8_t>* bytebuffer) : byteBuffer_(bytebuffer) {}
+    // Writes into a caller-provided region, which must be sized by BridgePackager::ComputeEncodedSize.
+    BridgeBinaryMarshaller(uint8_t* rawBuffer, size_t capacity) : rawBuffer_(rawBuffer), capacity_(capacity) {}
     virtual ~BridgeBinaryMarshaller() = default;
 
     constexpr static uint8_t MARSHALL_SIZE_0 = 0;
@@ -35,7 +38,19 @@ public:
     constexpr static uint8_t MARSHALL_SIZE_4 = 4;
     constexpr static uint8_t MARSHALL_SIZE_8 = 8;
 
-    void MarshallingByte(uint8_t byte) { byteBuffer_->push_back(byte); }
+    void MarshallingByte(uint8_t byte)
+    {
+        if (byteBuffer_) {
+            byteBuffer_->push_back(byte);
+            return;
+        }
+        if (rawBuffer_ == nullptr || position_ >= capacity_) {
+            LOGE("MarshallingByte: the buffer is overflow.");
+            overflow_ = true;
+            return;
+        }
+        rawBuffer_[position_++] = byte;
+    }
 
     void MarshallingBytes(const uint8_t* buffer, size_t size)
     {
@@ -43,7 +58,17 @@ public:
             LOGE("invalid write in writebyte function.");
             return;
         }
-        byteBuffer_->insert(byteBuffer_->end(), buffer, buffer + size);
+        if (byteBuffer_) {
+            byteBuffer_->insert(byteBuffer_->end(), buffer, buffer + size);
+            return;
+        }
+        if (rawBuffer_ == nullptr || size > capacity_ - position_ ||
+            memcpy_s(rawBuffer_ + position_, capacity_ - position_, buffer, size) != EOK) {
+            LOGE("MarshallingBytes: the buffer is overflow.");
+            overflow_ = true;
+            return;
+        }
+        position_ += size;
     }
 
     void MarshallingInt32(int32_t int32Value)
@@ -63,17 +88,21 @@ public:
 
     void MarshallingAlign(uint8_t align)
     {
-        if (uint8_t offset = byteBuffer_->size() % align; offset) {
-            int i = 0; 
-            while (i < align - offset) {
-                MarshallingByte(0);
-                ++i;
-            }
+        if (uint8_t offset = GetSize() % align; offset) {
+            static constexpr uint8_t padding[MARSHALL_SIZE_8] = { 0 };
+            MarshallingBytes(padding, align - offset);
         }
     }
 
+    size_t GetSize() const { return byteBuffer_ ? byteBuffer_->size() : position_; }
+    bool IsOverflow() const { return overflow_; }
+
 private:
-    std::vector<uint8_t>* byteBuffer_;
+    std::vector<uint8_t>* byteBuffer_ = nullptr;
+    uint8_t* rawBuffer_ = nullptr;
+    size_t capacity_ = 0;
+    size_t position_ = 0;
+    bool overflow_ = false;
 };
 } // OHOS::Plugin::Bridge 
 #endif
\ No newline at end of file
@@ -60,6 +60,18 @@ public:
         return;
     }
 
+    const uint8_t* UnmarshallingBorrow(size_t size)
+    {
+        if (currentPos_ + size <= size_) {
+            const uint8_t* head = &byteBuffer_[currentPos_];
+            currentPos_ += size;
+            return head;
+        }
+
+        LOGE("UnmarshallingBorrow fail.");
+        return nullptr;
+    }
+
     int32_t UnmarshallingInt32()
     {
         int32_t int32Value = 0;
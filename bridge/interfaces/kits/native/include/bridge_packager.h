@@ -16,32 +16,29 @@
 #ifndef PLUGINS_BRIDGE_BRIDGE_PACKAGER_H
 #define PLUGINS_BRIDGE_BRIDGE_PACKAGER_H
 
-#include <functional>
-#include <map>
 #include <vector>
 
 #include "bridge_binary_marshaller.h"
 #include "bridge_binary_unmarshaller.h"
 #include "codecable_value.h"
+#include "codecable_view.h"
 
 namespace OHOS::Plugin::Bridge {
 class BridgePackager {
 public:
-    using UnMarshallFunc = std::function<CodecableValue(BridgeBinaryUnmarshaller*)>;
-    using UnMarshallFuncMap = std::map<CodecableIndex, UnMarshallFunc>;
-    using UnMarshallFuncValueType = std::map<CodecableIndex, UnMarshallFunc>::value_type;
-    const static UnMarshallFuncMap unMarshallFuncMap;
-
-    using MarshallFunc = std::function<void(const CodecableValue& value, BridgeBinaryMarshaller* buffer)>;
-    using MarshallFuncMap = std::map<CodecableType, MarshallFunc>;
-    using MarshallFuncValueType = std::map<CodecableType, MarshallFunc>::value_type;
-    const static MarshallFuncMap marshallFuncMap;
+    using UnMarshallFunc = CodecableValue (*)(BridgeBinaryUnmarshaller*);
 
     static CodecableIndex GetCodecableIndex(const CodecableValue& value);
 
     static CodecableValue UnMarshalling(BridgeBinaryUnmarshaller* pendingBuffer);
     static void Marshalling(const CodecableValue& value, BridgeBinaryMarshaller* pendingBuffer);
 
+    // Returns the exact number of bytes Marshalling() writes for value, alignment padding included.
+    static size_t ComputeEncodedSize(const CodecableValue& value);
+    static size_t ComputeEncodedEnd(const CodecableValue& value, size_t offset);
+    static size_t ComputeSizeEnd(size_t size, size_t offset);
+    static size_t ComputeAlignedEnd(size_t offset, uint8_t align);
+
     static size_t UnMarshallingSize(BridgeBinaryUnmarshaller* pendingBuffer);
     static void MarshallingSize(size_t size, BridgeBinaryMarshaller* pendingBuffer);
 
@@ -60,6 +57,14 @@ public:
     static CodecableValue UnMarshallingCompositeList(BridgeBinaryUnmarshaller* pendingBuffer);
     static void MarshallingCompositeList(const CodecableList& value, BridgeBinaryMarshaller* pendingBuffer);
 
+    static CodecableView UnMarshallingView(BridgeBinaryUnmarshaller* pendingBuffer);
+    static CodecableView UnMarshallingStringView(BridgeBinaryUnmarshaller* pendingBuffer);
+    static CodecableView UnMarshallingListStringView(BridgeBinaryUnmarshaller* pendingBuffer);
+    static CodecableView UnMarshallingMapView(BridgeBinaryUnmarshaller* pendingBuffer);
+    static CodecableView UnMarshallingCompositeListView(BridgeBinaryUnmarshaller* pendingBuffer);
+
+    template <typename T>
+    static CodecableView UnMarshallingSpan(BridgeBinaryUnmarshaller* pendingBuffer);
     template <typename T>
     static CodecableValue UnMarshallingVector(BridgeBinaryUnmarshaller* pendingBuffer);
     template <typename T>
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PLUGINS_BRIDGE_CODECABLE_VIEW_H
+#define PLUGINS_BRIDGE_CODECABLE_VIEW_H
+
+#include <cstdint>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "codecable_value.h"
+#include "securec.h"
+
+namespace OHOS::Plugin::Bridge {
+/*
+ * A typed list borrowed from an encoded buffer. The elements are not copied,
+ * so the span is only valid while the buffer it was decoded from is alive.
+ * The buffer is not guaranteed to be aligned for T, elements are read by copy.
+ */
+template <typename T>
+class CodecableSpan {
+public:
+    CodecableSpan() = default;
+    CodecableSpan(const uint8_t* bytes, size_t size) : bytes_(bytes), size_(size) {}
+
+    const uint8_t* Bytes() const { return bytes_; }
+    size_t Size() const { return size_; }
+    size_t ByteSize() const { return size_ * sizeof(T); }
+    bool Empty() const { return size_ == 0; }
+
+    T At(size_t index) const
+    {
+        T value {};
+        if (bytes_ != nullptr && index < size_) {
+            memcpy_s(&value, sizeof(T), bytes_ + index * sizeof(T), sizeof(T));
+        }
+        return value;
+    }
+
+    std::vector<T> ToVector() const
+    {
+        std::vector<T> vector;
+        if (bytes_ == nullptr || size_ == 0) {
+            return vector;
+        }
+        vector.resize(size_);
+        memcpy_s(vector.data(), ByteSize(), bytes_, ByteSize());
+        return vector;
+    }
+
+private:
+    const uint8_t* bytes_ = nullptr;
+    size_t size_ = 0;
+};
+
+// Booleans are encoded as CodecableIndex bytes, not as C++ bool.
+template <>
+inline bool CodecableSpan<bool>::At(size_t index) const
+{
+    if (bytes_ == nullptr || index >= size_) {
+        return false;
+    }
+    return static_cast<CodecableIndex>(bytes_[index]) == CodecableIndex::I_TRUE;
+}
+
+template <>
+inline std::vector<bool> CodecableSpan<bool>::ToVector() const
+{
+    std::vector<bool> vector;
+    vector.reserve(size_);
+    for (size_t i = 0; i < size_; ++i) {
+        vector.push_back(At(i));
+    }
+    return vector;
+}
+
+class CodecableView;
+
+using CodecableViewList = std::vector<CodecableView>;
+using CodecableViewMap = std::vector<std::pair<CodecableView, CodecableView>>;
+using CodecableViewVariant = std::variant<std::monostate,                                   // index 0
+                                            bool,                                           // index 1
+                                            int32_t,                                        // index 2
+                                            int64_t,                                        // index 3
+                                            double,                                         // index 4
+                                            std::string_view,                               // index 5
+                                            CodecableSpan<uint8_t>,                         // index 6
+                                            CodecableSpan<bool>,                            // index 7
+                                            CodecableSpan<int32_t>,                         // index 8
+                                            CodecableSpan<int64_t>,                         // index 9
+                                            CodecableSpan<double>,                          // index 10
+                                            std::vector<std::string_view>,                  // index 11
+                                            CodecableViewMap,                               // index 12
+                                            CodecableViewList>;                             // index 13
+
+/*
+ * Borrowed counterpart of CodecableValue. The variant indexes match CodecableType,
+ * strings and typed lists point into the decoded buffer, and Materialize() builds
+ * an owning CodecableValue only when the caller needs one.
+ */
+class CodecableView : public CodecableViewVariant {
+public:
+    using CodecableViewVariant::CodecableViewVariant;
+    using CodecableViewVariant::operator=;
+
+    CodecableView() = default;
+
+    CodecableType GetType() const { return static_cast<CodecableType>(index()); }
+    CodecableValue Materialize() const;
+};
+} // namespace OHOS::Plugin::Bridge
+#endif
@@ -28,6 +28,7 @@ const BridgeBinaryCodec& BridgeBinaryCodec::GetInstance()
 std::unique_ptr<std::vector<uint8_t>> BridgeBinaryCodec::EncodeInner(const CodecableValue& data) const
 {
     auto coded = std::make_unique<std::vector<uint8_t>>();
+    coded->reserve(BridgePackager::ComputeEncodedSize(data));
     BridgeBinaryMarshaller marshaller(coded.get());
     BridgePackager::Marshalling(data, &marshaller);
     return coded;
@@ -36,11 +37,32 @@ std::unique_ptr<std::vector<uint8_t>> BridgeBinaryCodec::EncodeInner(const Codec
 std::vector<uint8_t>* BridgeBinaryCodec::EncodeBuffer(const CodecableValue& data) const
 {
     std::vector<uint8_t>* coded = new (std::nothrow) std::vector<uint8_t>();
+    if (coded == nullptr) {
+        LOGE("EncodeBuffer: Failed to create the buffer.");
+        return nullptr;
+    }
+    coded->reserve(BridgePackager::ComputeEncodedSize(data));
     BridgeBinaryMarshaller marshaller(coded);
     BridgePackager::Marshalling(data, &marshaller);
     return coded;
 }
 
+size_t BridgeBinaryCodec::EncodeBuffer(const CodecableValue& data, uint8_t* buffer, size_t capacity) const
+{
+    if (buffer == nullptr || capacity == BridgeBinaryMarshaller::MARSHALL_SIZE_0) {
+        LOGE("EncodeBuffer: The buffer is error.");
+        return 0;
+    }
+    BridgeBinaryMarshaller marshaller(buffer, capacity);
+    BridgePackager::Marshalling(data, &marshaller);
+    if (marshaller.IsOverflow()) {
+        LOGE("EncodeBuffer: The buffer is too small, need %{public}zu bytes.",
+            BridgePackager::ComputeEncodedSize(data));
+        return 0;
+    }
+    return marshaller.GetSize();
+}
+
 std::unique_ptr<CodecableValue> BridgeBinaryCodec::DecodeInner(const std::vector<uint8_t>& data) const
 {
     size_t size = data.size();
@@ -66,4 +88,14 @@ std::unique_ptr<CodecableValue> BridgeBinaryCodec::DecodeBuffer(const uint8_t* d
     BridgeBinaryUnmarshaller unMarshaller(dataPtr, size);
     return std::make_unique<CodecableValue>(BridgePackager::UnMarshalling(&unMarshaller));
 }
+
+std::unique_ptr<CodecableView> BridgeBinaryCodec::DecodeBufferView(const uint8_t* dataPtr, size_t size) const
+{
+    if (!dataPtr || size == BridgeBinaryUnmarshaller::UNMARSHALL_SIZE_0) {
+        LOGW("The decode data is error.");
+        return std::make_unique<CodecableView>();
+    }
+    BridgeBinaryUnmarshaller unMarshaller(dataPtr, size);
+    return std::make_unique<CodecableView>(BridgePackager::UnMarshallingView(&unMarshaller));
+}
 } // OHOS::Plugin::Bridge
\ No newline at end of file
@@ -16,6 +16,7 @@
 #include "bridge_json_codec.h"
 
 #include "napi_utils.h"
+#include "plugins/interfaces/native/inner_api/plugin_utils_napi.h"
 
 namespace OHOS::Plugin::Bridge {
 /*
@@ -44,25 +45,34 @@ std::unique_ptr<DecodeValue> BridgeJsonCodec::EncodeInner(const NapiRawValue& da
         return std::move(parameter);
     }
 
-    Json json {};
-    if (data.value != nullptr) {
-        json[MESSAGE_RESPONSE_RESULT] = NAPIUtils::PlatformParams(data.env, data.value);
-    } else if (data.isForError) {
-        json[MESSAGE_RESPONSE_RESULT] = 0;
-    } else {
-        json[MESSAGE_RESPONSE_RESULT] = "";
-    }
-
+    // Members are written in the key order Json::dump used: errorCode, errorMessage, result.
+    auto parameter = std::make_unique<DecodeValue>();
+    std::string& str = parameter->value;
+    str += '{';
     if (data.errorCode != -1) {
-        json[MESSAGE_RESPONSE_ERROR_CODE] = data.errorCode;
+        NAPIUtils::AppendJsonString(MESSAGE_RESPONSE_ERROR_CODE, str);
+        str += ':';
+        str += std::to_string(data.errorCode);
+        str += ',';
     }
 
     if (!data.errorMessage.empty()) {
-        json[MESSAGE_RESPONSE_ERROR_MESSAGE] = data.errorMessage;
+        NAPIUtils::AppendJsonString(MESSAGE_RESPONSE_ERROR_MESSAGE, str);
+        str += ':';
+        NAPIUtils::AppendJsonString(data.errorMessage, str);
+        str += ',';
     }
 
-    auto parameter = std::make_unique<DecodeValue>();
-    parameter->value = json.dump();
+    NAPIUtils::AppendJsonString(MESSAGE_RESPONSE_RESULT, str);
+    str += ':';
+    if (data.value != nullptr) {
+        NAPIUtils::AppendNapiValueToJson(data.env, data.value, str);
+    } else if (data.isForError) {
+        str += '0';
+    } else {
+        str += "\"\"";
+    }
+    str += '}';
 
     return std::move(parameter);
 }
@@ -71,23 +81,25 @@ std::unique_ptr<NapiRawValue> BridgeJsonCodec::DecodeInner(const DecodeValue& de
 {
     auto rawValue = std::make_unique<NapiRawValue>();
 
-    auto jsonObject = Json::parse(decodeValue.value, nullptr, false);
+    NapiJsonMembers members;
+    NAPIUtils::JsonStringToNapiMembers(decodeValue.env, decodeValue.value, members);
 
-    auto it = jsonObject.find(MESSAGE_RESPONSE_ERROR_CODE);
-    if (it != jsonObject.end()) {
-        rawValue->errorCode = NAPIUtils::NAPI_GetErrorCodeFromJson(jsonObject.at(MESSAGE_RESPONSE_ERROR_CODE));
+    napi_value errorCode = NAPIUtils::FindJsonMember(members, MESSAGE_RESPONSE_ERROR_CODE);
+    if (errorCode != nullptr) {
+        rawValue->errorCode = -1;
+        if (PluginUtilsNApi::GetValueType(decodeValue.env, errorCode) == napi_number) {
+            rawValue->errorCode = PluginUtilsNApi::GetCInt32(errorCode, decodeValue.env);
+        }
     }
 
-    it = jsonObject.find(MESSAGE_RESPONSE_RESULT);
-    Json resultJson;
-    rawValue->value = NAPIUtils::NAPI_GetParams(decodeValue.env, resultJson);
-    if (it != jsonObject.end()) {
-        rawValue->value = NAPIUtils::NAPI_GetParams(decodeValue.env, jsonObject.at(MESSAGE_RESPONSE_RESULT));
+    rawValue->value = NAPIUtils::FindJsonMember(members, MESSAGE_RESPONSE_RESULT);
+    if (rawValue->value == nullptr) {
+        rawValue->value = PluginUtilsNApi::CreateNull(decodeValue.env);
     }
 
-    it = jsonObject.find(MESSAGE_RESPONSE_ERROR_MESSAGE);
-    if (it != jsonObject.end()) {
-        rawValue->errorMessage = jsonObject.at(MESSAGE_RESPONSE_ERROR_MESSAGE).get<std::string>();
+    napi_value errorMessage = NAPIUtils::FindJsonMember(members, MESSAGE_RESPONSE_ERROR_MESSAGE);
+    if (errorMessage != nullptr) {
+        rawValue->errorMessage = PluginUtilsNApi::GetStringFromValueUtf8(decodeValue.env, errorMessage);
     }
 
     return std::move(rawValue);
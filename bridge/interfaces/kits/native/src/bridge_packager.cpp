@@ -15,94 +15,53 @@
 
 #include "bridge_packager.h"
 
+#include <array>
 #include <cstring>
 #include <iostream>
-#include <map>
 #include <string>
+#include <type_traits>
+#include <variant>
 #include <vector>
 
 #include "log.h"
 
 namespace OHOS::Plugin::Bridge {
-const BridgePackager::UnMarshallFuncMap BridgePackager::unMarshallFuncMap = {
-    BridgePackager::UnMarshallFuncValueType(CodecableIndex::I_NULL,
-        [](BridgeBinaryUnmarshaller*) { return CodecableValue(); }),
-    BridgePackager::UnMarshallFuncValueType(CodecableIndex::I_TRUE,
-        [](BridgeBinaryUnmarshaller*) { return CodecableValue(true); }),
-    BridgePackager::UnMarshallFuncValueType(CodecableIndex::I_FALSE,
-        [](BridgeBinaryUnmarshaller*) { return CodecableValue(false); }),
-    BridgePackager::UnMarshallFuncValueType(CodecableIndex::I_INT32,
-        [](BridgeBinaryUnmarshaller* buffer) { return CodecableValue(buffer->UnmarshallingInt32()); }),
-    BridgePackager::UnMarshallFuncValueType(CodecableIndex::I_INT64,
-        [](BridgeBinaryUnmarshaller* buffer) { return CodecableValue(buffer->UnmarshallingInt64()); }),
-    BridgePackager::UnMarshallFuncValueType(CodecableIndex::I_DOUBLE,
-        [](BridgeBinaryUnmarshaller* buffer) {
-            buffer->UnmarshallingAlign(8);
-            return CodecableValue(buffer->UnmarshallingDouble());
-        }),
-    BridgePackager::UnMarshallFuncValueType(CodecableIndex::I_STRING,
-        [](BridgeBinaryUnmarshaller* buffer) { return BridgePackager::UnMarshallingString(buffer); }),
-    BridgePackager::UnMarshallFuncValueType(CodecableIndex::I_LIST_UINT8,
-        [](BridgeBinaryUnmarshaller* buffer) { return BridgePackager::UnMarshallingVector<uint8_t>(buffer); }),
-    BridgePackager::UnMarshallFuncValueType(CodecableIndex::I_LIST_BOOL,
-        [](BridgeBinaryUnmarshaller* buffer) { return BridgePackager::UnMarshallingListBool(buffer); }),
-    BridgePackager::UnMarshallFuncValueType(CodecableIndex::I_LIST_INT32,
-        [](BridgeBinaryUnmarshaller* buffer) { return BridgePackager::UnMarshallingVector<int32_t>(buffer); }),
-    BridgePackager::UnMarshallFuncValueType(CodecableIndex::I_LIST_INT64,
-        [](BridgeBinaryUnmarshaller* buffer) { return BridgePackager::UnMarshallingVector<int64_t>(buffer); }),
-    BridgePackager::UnMarshallFuncValueType(CodecableIndex::I_LIST_DOUBLE,
-        [](BridgeBinaryUnmarshaller* buffer) { return BridgePackager::UnMarshallingVector<double>(buffer); }),
-    BridgePackager::UnMarshallFuncValueType(CodecableIndex::I_LIST_STRING,
-        [](BridgeBinaryUnmarshaller* buffer) { return BridgePackager::UnMarshallingListString(buffer); }),
-    BridgePackager::UnMarshallFuncValueType(CodecableIndex::I_MAP,
-        [](BridgeBinaryUnmarshaller* buffer) { return BridgePackager::UnMarshallingMap(buffer); }),
-    BridgePackager::UnMarshallFuncValueType(CodecableIndex::I_COMPOSITE_LIST,
-        [](BridgeBinaryUnmarshaller* buffer) { return BridgePackager::UnMarshallingCompositeList(buffer); })
-    };
-
-const BridgePackager::MarshallFuncMap BridgePackager::marshallFuncMap = {
-    BridgePackager::MarshallFuncValueType(CodecableType::T_NULL,
-        [](const CodecableValue&, BridgeBinaryMarshaller*) { }),
-    BridgePackager::MarshallFuncValueType(CodecableType::T_BOOL,
-        [](const CodecableValue&, BridgeBinaryMarshaller*) { }),
-    BridgePackager::MarshallFuncValueType(CodecableType::T_INT32,
-        [](const CodecableValue& value, BridgeBinaryMarshaller* buffer) {
-            buffer->MarshallingInt32(std::get<int32_t>(value)); }),
-    BridgePackager::MarshallFuncValueType(CodecableType::T_INT64,
-        [](const CodecableValue& value, BridgeBinaryMarshaller* buffer) {
-            buffer->MarshallingInt64(std::get<int64_t>(value)); }),
-    BridgePackager::MarshallFuncValueType(CodecableType::T_DOUBLE,
-        [](const CodecableValue& value, BridgeBinaryMarshaller* buffer) {
-            buffer->MarshallingAlign(8);
-            buffer->MarshallingDouble(std::get<double>(value));}),
-    BridgePackager::MarshallFuncValueType(CodecableType::T_STRING,
-        [](const CodecableValue& value, BridgeBinaryMarshaller* buffer) {
-            BridgePackager::MarshallingString(std::get<std::string>(value), buffer); }),
-    BridgePackager::MarshallFuncValueType(CodecableType::T_LIST_UINT8,
-        [](const CodecableValue& value, BridgeBinaryMarshaller* buffer) {
-            BridgePackager::MarshallingVector(std::get<std::vector<uint8_t>>(value), buffer); }),
-    BridgePackager::MarshallFuncValueType(CodecableType::T_LIST_BOOL,
-        [](const CodecableValue& value, BridgeBinaryMarshaller* buffer) {
-            BridgePackager::MarshallingListBool(std::get<std::vector<bool>>(value), buffer); }),
-    BridgePackager::MarshallFuncValueType(CodecableType::T_LIST_INT32,
-        [](const CodecableValue& value, BridgeBinaryMarshaller* buffer) {
-            BridgePackager::MarshallingVector(std::get<std::vector<int32_t>>(value), buffer); }),
-    BridgePackager::MarshallFuncValueType(CodecableType::T_LIST_INT64,
-        [](const CodecableValue& value, BridgeBinaryMarshaller* buffer) {
-            BridgePackager::MarshallingVector(std::get<std::vector<int64_t>>(value), buffer); }),
-    BridgePackager::MarshallFuncValueType(CodecableType::T_LIST_DOUBLE,
-        [](const CodecableValue& value, BridgeBinaryMarshaller* buffer) {
-            BridgePackager::MarshallingVector(std::get<std::vector<double>>(value), buffer); }),
-    BridgePackager::MarshallFuncValueType(CodecableType::T_LIST_STRING,
-        [](const CodecableValue& value, BridgeBinaryMarshaller* buffer) {
-            BridgePackager::MarshallingListString(std::get<std::vector<std::string>>(value), buffer); }),
-    BridgePackager::MarshallFuncValueType(CodecableType::T_MAP,
-        [](const CodecableValue& value, BridgeBinaryMarshaller* buffer) {
-            BridgePackager::MarshallingMap(std::get<CodecableMap>(value), buffer); }),
-    BridgePackager::MarshallFuncValueType(CodecableType::T_COMPOSITE_LIST,
-        [](const CodecableValue& value, BridgeBinaryMarshaller* buffer) {
-            BridgePackager::MarshallingCompositeList(std::get<CodecableList>(value), buffer); }),
-    };
+namespace {
+constexpr size_t UNMARSHALL_FUNC_COUNT = static_cast<size_t>(CodecableIndex::I_COMPOSITE_LIST) + 1;
+
+// Indexed by CodecableIndex, keep the order in sync with the enum.
+constexpr std::array<BridgePackager::UnMarshallFunc, UNMARSHALL_FUNC_COUNT> UNMARSHALL_FUNC_TABLE = {
+    [](BridgeBinaryUnmarshaller*) { return CodecableValue(); },
+    [](BridgeBinaryUnmarshaller*) { return CodecableValue(true); },
+    [](BridgeBinaryUnmarshaller*) { return CodecableValue(false); },
+    [](BridgeBinaryUnmarshaller* buffer) { return CodecableValue(buffer->UnmarshallingInt32()); },
+    [](BridgeBinaryUnmarshaller* buffer) { return CodecableValue(buffer->UnmarshallingInt64()); },
+    [](BridgeBinaryUnmarshaller* buffer) {
+        buffer->UnmarshallingAlign(8);
+        return CodecableValue(buffer->UnmarshallingDouble());
+    },
+    &BridgePackager::UnMarshallingString,
+    &BridgePackager::UnMarshallingVector<uint8_t>,
+    &BridgePackager::UnMarshallingListBool,
+    &BridgePackager::UnMarshallingVector<int32_t>,
+    &BridgePackager::UnMarshallingVector<int64_t>,
+    &BridgePackager::UnMarshallingVector<double>,
+    &BridgePackager::UnMarshallingListString,
+    &BridgePackager::UnMarshallingMap,
+    &BridgePackager::UnMarshallingCompositeList,
+};
+
+template <typename T>
+struct IsTypedVector : std::false_type {};
+template <>
+struct IsTypedVector<std::vector<uint8_t>> : std::true_type {};
+template <>
+struct IsTypedVector<std::vector<int32_t>> : std::true_type {};
+template <>
+struct IsTypedVector<std::vector<int64_t>> : std::true_type {};
+template <>
+struct IsTypedVector<std::vector<double>> : std::true_type {};
+} // namespace
 
 CodecableIndex BridgePackager::GetCodecableIndex(const CodecableValue& value)
 {
@@ -123,10 +82,9 @@ CodecableValue BridgePackager::UnMarshalling(BridgeBinaryUnmarshaller* pendingBu
         return CodecableValue();
     }
 
-    CodecableIndex index = static_cast<CodecableIndex>(pendingBuffer->UnmarshallingByte());
-    auto iter = unMarshallFuncMap.find(index);
-    if (iter != unMarshallFuncMap.end()) {
-        return (iter->second)(pendingBuffer);
+    size_t index = static_cast<size_t>(pendingBuffer->UnmarshallingByte());
+    if (index < UNMARSHALL_FUNC_TABLE.size()) {
+        return UNMARSHALL_FUNC_TABLE[index](pendingBuffer);
     }
 
     LOGW("invaild type, can not unmarshalling value from buffer.");
@@ -141,15 +99,130 @@ void BridgePackager::Marshalling(const CodecableValue& value, BridgeBinaryMarsha
     }
 
     pendingBuffer->MarshallingByte(static_cast<uint8_t>(GetCodecableIndex(value)));
-    CodecableType type = static_cast<CodecableType>(value.index());
-    auto iter = marshallFuncMap.find(type);
-    if (iter != marshallFuncMap.end()) {
-        (iter->second)(value, pendingBuffer);
-        return;
+    std::visit([pendingBuffer](const auto& item) {
+        using T = std::decay_t<decltype(item)>;
+        if constexpr (std::is_same_v<T, int32_t>) {
+            pendingBuffer->MarshallingInt32(item);
+        } else if constexpr (std::is_same_v<T, int64_t>) {
+            pendingBuffer->MarshallingInt64(item);
+        } else if constexpr (std::is_same_v<T, double>) {
+            pendingBuffer->MarshallingAlign(8);
+            pendingBuffer->MarshallingDouble(item);
+        } else if constexpr (std::is_same_v<T, std::string>) {
+            MarshallingString(item, pendingBuffer);
+        } else if constexpr (std::is_same_v<T, std::vector<bool>>) {
+            MarshallingListBool(item, pendingBuffer);
+        } else if constexpr (std::is_same_v<T, std::vector<std::string>>) {
+            MarshallingListString(item, pendingBuffer);
+        } else if constexpr (std::is_same_v<T, CodecableMap>) {
+            MarshallingMap(item, pendingBuffer);
+        } else if constexpr (std::is_same_v<T, CodecableList>) {
+            MarshallingCompositeList(item, pendingBuffer);
+        } else if constexpr (IsTypedVector<T>::value) {
+            MarshallingVector(item, pendingBuffer);
+        }
+    }, static_cast<const CodecableVariant&>(value));
+}
+
+size_t BridgePackager::ComputeEncodedSize(const CodecableValue& value)
+{
+    return ComputeEncodedEnd(value, 0);
+}
+
+size_t BridgePackager::ComputeAlignedEnd(size_t offset, uint8_t align)
+{
+    if (size_t remainder = offset % align; remainder) {
+        return offset + align - remainder;
     }
+    return offset;
+}
 
-    LOGW("invaild type, can not marshalling value to buffer.");
-    return;
+size_t BridgePackager::ComputeSizeEnd(size_t size, size_t offset)
+{
+    if (size < 0xFE) {
+        return offset + BridgeBinaryMarshaller::MARSHALL_SIZE_1;
+    }
+    if (size <= 0xFFFF) {
+        return offset + BridgeBinaryMarshaller::MARSHALL_SIZE_1 + BridgeBinaryMarshaller::MARSHALL_SIZE_2;
+    }
+    return offset + BridgeBinaryMarshaller::MARSHALL_SIZE_1 + BridgeBinaryMarshaller::MARSHALL_SIZE_4;
+}
+
+namespace {
+template<typename T>
+size_t ComputeVectorEnd(const std::vector<T>& vector, size_t offset)
+{
+    size_t size = vector.size();
+    offset = BridgePackager::ComputeSizeEnd(size, offset);
+    if (size == BridgeBinaryMarshaller::MARSHALL_SIZE_0) {
+        return offset;
+    }
+    uint8_t tSize = static_cast<uint8_t>(sizeof(T));
+    if (tSize > BridgeBinaryMarshaller::MARSHALL_SIZE_1) {
+        offset = BridgePackager::ComputeAlignedEnd(offset, tSize);
+    }
+    return offset + size * tSize;
+}
+} // namespace
+
+size_t BridgePackager::ComputeEncodedEnd(const CodecableValue& value, size_t offset)
+{
+    offset += BridgeBinaryMarshaller::MARSHALL_SIZE_1;
+    switch (static_cast<CodecableType>(value.index())) {
+        case CodecableType::T_NULL:
+        case CodecableType::T_BOOL:
+            return offset;
+        case CodecableType::T_INT32:
+            return offset + BridgeBinaryMarshaller::MARSHALL_SIZE_4;
+        case CodecableType::T_INT64:
+            return offset + BridgeBinaryMarshaller::MARSHALL_SIZE_8;
+        case CodecableType::T_DOUBLE:
+            return ComputeAlignedEnd(offset, BridgeBinaryMarshaller::MARSHALL_SIZE_8) +
+                BridgeBinaryMarshaller::MARSHALL_SIZE_8;
+        case CodecableType::T_STRING: {
+            const auto& str = std::get<std::string>(value);
+            return ComputeSizeEnd(str.size(), offset) + str.size();
+        }
+        case CodecableType::T_LIST_UINT8:
+            return ComputeVectorEnd(std::get<std::vector<uint8_t>>(value), offset);
+        case CodecableType::T_LIST_BOOL: {
+            const auto& vector = std::get<std::vector<bool>>(value);
+            return ComputeSizeEnd(vector.size(), offset) + vector.size();
+        }
+        case CodecableType::T_LIST_INT32:
+            return ComputeVectorEnd(std::get<std::vector<int32_t>>(value), offset);
+        case CodecableType::T_LIST_INT64:
+            return ComputeVectorEnd(std::get<std::vector<int64_t>>(value), offset);
+        case CodecableType::T_LIST_DOUBLE:
+            return ComputeVectorEnd(std::get<std::vector<double>>(value), offset);
+        case CodecableType::T_LIST_STRING: {
+            const auto& vector = std::get<std::vector<std::string>>(value);
+            offset = ComputeSizeEnd(vector.size(), offset);
+            for (const auto& item : vector) {
+                offset = ComputeSizeEnd(item.size(), offset) + item.size();
+            }
+            return offset;
+        }
+        case CodecableType::T_MAP: {
+            const auto& map = std::get<CodecableMap>(value);
+            offset = ComputeSizeEnd(map.size(), offset);
+            for (const auto& pair : map) {
+                offset = ComputeEncodedEnd(pair.first, offset);
+                offset = ComputeEncodedEnd(pair.second, offset);
+            }
+            return offset;
+        }
+        case CodecableType::T_COMPOSITE_LIST: {
+            const auto& list = std::get<CodecableList>(value);
+            offset = ComputeSizeEnd(list.size(), offset);
+            for (const auto& item : list) {
+                offset = ComputeEncodedEnd(item, offset);
+            }
+            return offset;
+        }
+        default:
+            return offset;
+    }
 }
 
 void BridgePackager::MarshallingListBool(const std::vector<bool>& vector, BridgeBinaryMarshaller* pendingBuffer)
@@ -337,4 +410,118 @@ void BridgePackager::MarshallingCompositeList(const CodecableList& list, BridgeB
         Marshalling(item, pendingBuffer);
     }
 }
+
+CodecableView BridgePackager::UnMarshallingView(BridgeBinaryUnmarshaller* pendingBuffer)
+{
+    if (!pendingBuffer) {
+        LOGE("pendingBuffer is nullptr, will return null.");
+        return CodecableView();
+    }
+
+    CodecableIndex index = static_cast<CodecableIndex>(pendingBuffer->UnmarshallingByte());
+    switch (index) {
+        case CodecableIndex::I_NULL:
+            return CodecableView();
+        case CodecableIndex::I_TRUE:
+            return CodecableView(true);
+        case CodecableIndex::I_FALSE:
+            return CodecableView(false);
+        case CodecableIndex::I_INT32:
+            return CodecableView(pendingBuffer->UnmarshallingInt32());
+        case CodecableIndex::I_INT64:
+            return CodecableView(pendingBuffer->UnmarshallingInt64());
+        case CodecableIndex::I_DOUBLE:
+            pendingBuffer->UnmarshallingAlign(8);
+            return CodecableView(pendingBuffer->UnmarshallingDouble());
+        case CodecableIndex::I_STRING:
+            return UnMarshallingStringView(pendingBuffer);
+        case CodecableIndex::I_LIST_UINT8:
+            return UnMarshallingSpan<uint8_t>(pendingBuffer);
+        case CodecableIndex::I_LIST_BOOL:
+            return UnMarshallingSpan<bool>(pendingBuffer);
+        case CodecableIndex::I_LIST_INT32:
+            return UnMarshallingSpan<int32_t>(pendingBuffer);
+        case CodecableIndex::I_LIST_INT64:
+            return UnMarshallingSpan<int64_t>(pendingBuffer);
+        case CodecableIndex::I_LIST_DOUBLE:
+            return UnMarshallingSpan<double>(pendingBuffer);
+        case CodecableIndex::I_LIST_STRING:
+            return UnMarshallingListStringView(pendingBuffer);
+        case CodecableIndex::I_MAP:
+            return UnMarshallingMapView(pendingBuffer);
+        case CodecableIndex::I_COMPOSITE_LIST:
+            return UnMarshallingCompositeListView(pendingBuffer);
+        default:
+            break;
+    }
+
+    LOGW("invaild type, can not unmarshalling view from buffer.");
+    return CodecableView();
+}
+
+CodecableView BridgePackager::UnMarshallingStringView(BridgeBinaryUnmarshaller* pendingBuffer)
+{
+    size_t size = UnMarshallingSize(pendingBuffer);
+    const uint8_t* head = pendingBuffer->UnmarshallingBorrow(size);
+    if (head == nullptr) {
+        return CodecableView(std::string_view());
+    }
+    return CodecableView(std::string_view(reinterpret_cast<const char*>(head), size));
+}
+
+CodecableView BridgePackager::UnMarshallingListStringView(BridgeBinaryUnmarshaller* pendingBuffer)
+{
+    size_t size = UnMarshallingSize(pendingBuffer);
+    std::vector<std::string_view> temp;
+    temp.reserve(size);
+    size_t i = 0;
+    while (i < size) {
+        temp.push_back(std::get<std::string_view>(UnMarshallingStringView(pendingBuffer)));
+        ++i;
+    }
+    return CodecableView(std::move(temp));
+}
+
+CodecableView BridgePackager::UnMarshallingMapView(BridgeBinaryUnmarshaller* pendingBuffer)
+{
+    size_t size = UnMarshallingSize(pendingBuffer);
+    CodecableViewMap tempMap;
+    tempMap.reserve(size);
+    size_t i = 0;
+    while (i < size) {
+        auto first = UnMarshallingView(pendingBuffer);
+        auto second = UnMarshallingView(pendingBuffer);
+        tempMap.emplace_back(std::move(first), std::move(second));
+        ++i;
+    }
+    return CodecableView(std::move(tempMap));
+}
+
+CodecableView BridgePackager::UnMarshallingCompositeListView(BridgeBinaryUnmarshaller* pendingBuffer)
+{
+    size_t size = UnMarshallingSize(pendingBuffer);
+    CodecableViewList list;
+    list.reserve(size);
+    size_t i = 0;
+    while (i < size) {
+        list.push_back(UnMarshallingView(pendingBuffer));
+        ++i;
+    }
+    return CodecableView(std::move(list));
+}
+
+template<typename T>
+CodecableView BridgePackager::UnMarshallingSpan(BridgeBinaryUnmarshaller* pendingBuffer)
+{
+    size_t size = UnMarshallingSize(pendingBuffer);
+    uint8_t tSize = static_cast<uint8_t>(sizeof(T));
+    if (size > BridgeBinaryUnmarshaller::UNMARSHALL_SIZE_0 && tSize > BridgeBinaryUnmarshaller::UNMARSHALL_SIZE_1) {
+        pendingBuffer->UnmarshallingAlign(tSize);
+    }
+    const uint8_t* head = pendingBuffer->UnmarshallingBorrow(size * tSize);
+    if (head == nullptr) {
+        return CodecableView(CodecableSpan<T>());
+    }
+    return CodecableView(CodecableSpan<T>(head, size));
+}
 } // OHOS::Plugin::Bridge
\ No newline at end of file
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "codecable_view.h"
+
+#include <string>
+
+namespace OHOS::Plugin::Bridge {
+CodecableValue CodecableView::Materialize() const
+{
+    switch (GetType()) {
+        case CodecableType::T_BOOL:
+            return CodecableValue(std::get<bool>(*this));
+        case CodecableType::T_INT32:
+            return CodecableValue(std::get<int32_t>(*this));
+        case CodecableType::T_INT64:
+            return CodecableValue(std::get<int64_t>(*this));
+        case CodecableType::T_DOUBLE:
+            return CodecableValue(std::get<double>(*this));
+        case CodecableType::T_STRING:
+            return CodecableValue(std::string(std::get<std::string_view>(*this)));
+        case CodecableType::T_LIST_UINT8:
+            return CodecableValue(std::get<CodecableSpan<uint8_t>>(*this).ToVector());
+        case CodecableType::T_LIST_BOOL:
+            return CodecableValue(std::get<CodecableSpan<bool>>(*this).ToVector());
+        case CodecableType::T_LIST_INT32:
+            return CodecableValue(std::get<CodecableSpan<int32_t>>(*this).ToVector());
+        case CodecableType::T_LIST_INT64:
+            return CodecableValue(std::get<CodecableSpan<int64_t>>(*this).ToVector());
+        case CodecableType::T_LIST_DOUBLE:
+            return CodecableValue(std::get<CodecableSpan<double>>(*this).ToVector());
+        case CodecableType::T_LIST_STRING: {
+            const auto& views = std::get<std::vector<std::string_view>>(*this);
+            std::vector<std::string> vector;
+            vector.reserve(views.size());
+            for (const auto& item : views) {
+                vector.emplace_back(item);
+            }
+            return CodecableValue(std::move(vector));
+        }
+        case CodecableType::T_MAP: {
+            CodecableMap map;
+            for (const auto& pair : std::get<CodecableViewMap>(*this)) {
+                map.emplace(pair.first.Materialize(), pair.second.Materialize());
+            }
+            return CodecableValue(std::move(map));
+        }
+        case CodecableType::T_COMPOSITE_LIST: {
+            const auto& views = std::get<CodecableViewList>(*this);
+            CodecableList list;
+            list.reserve(views.size());
+            for (const auto& item : views) {
+                list.push_back(item.Materialize());
+            }
+            return CodecableValue(std::move(list));
+        }
+        default:
+            return CodecableValue();
+    }
+}
+} // OHOS::Plugin::Bridge
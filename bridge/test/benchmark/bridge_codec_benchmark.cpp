@@ -0,0 +1,402 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "bridge_binary_codec.h"
+#include "bridge_json_codec.h"
+#include "bridge_packager.h"
+#include "napi/native_api.h"
+#include "napi_utils.h"
+
+/*
+ * Encode/decode benchmark for the bridge codecs, run on the host against the
+ * napi mock of the integration tests. Every case prints one record, as JSON
+ * (default) or CSV, so results can be diffed between releases.
+ *
+ * Usage: bridge_codec_benchmark [--format=json|csv] [--min-time=<seconds>]
+ */
+namespace OHOS::Plugin::Bridge {
+namespace {
+using Clock = std::chrono::steady_clock;
+
+constexpr double DEFAULT_MIN_SECONDS = 0.5;
+constexpr size_t BATCH_ITERATIONS = 8;
+constexpr double NS_PER_SECOND = 1e9;
+constexpr double BYTES_PER_MB = 1024.0 * 1024.0;
+
+constexpr int32_t SMALL_ARG_INT = 42;
+constexpr double SMALL_ARG_DOUBLE = 3.5;
+constexpr size_t BINARY_BYTE_ARRAY_SIZE = 1024 * 1024;
+// Every element of a JS array is a napi value, so the JSON case uses a smaller array.
+constexpr size_t JSON_BYTE_ARRAY_SIZE = 64 * 1024;
+constexpr size_t STRING_LIST_SIZE = 1000;
+constexpr size_t NESTED_MAP_DEPTH = 3;
+constexpr size_t NESTED_MAP_FANOUT = 8;
+// Heterogeneous lists, so every element goes through the per-value type dispatch.
+constexpr size_t SCALAR_LIST_SIZE = 1024;
+constexpr size_t NESTED_LIST_COUNT = 32;
+constexpr size_t NESTED_LIST_SIZE = 32;
+constexpr size_t SCALAR_KINDS = 5;
+constexpr uint32_t HIGH_WORD_SHIFT = 32;
+constexpr uint32_t BYTE_MASK = 0xff;
+
+struct BenchResult {
+    std::string codec;
+    std::string shape;
+    std::string operation;
+    size_t encodedBytes = 0;
+    size_t iterations = 0;
+    double nsPerOp = 0;
+    double mbPerSecond = 0;
+};
+
+struct JsonShape {
+    std::string name;
+    // Builds the call arguments with the napi mock.
+    std::function<std::vector<napi_value>(napi_env)> build;
+};
+
+struct BinaryShape {
+    std::string name;
+    CodecableValue value;
+};
+
+double g_minSeconds = DEFAULT_MIN_SECONDS;
+std::vector<BenchResult> g_results;
+int g_envTag = 0;
+napi_env g_env = &g_envTag;
+
+// Runs |body| in batches until g_minSeconds were measured. |prepare| runs untimed before each batch.
+void Measure(const std::string& codec, const std::string& shape, const std::string& operation, size_t encodedBytes,
+    const std::function<void()>& prepare, const std::function<void()>& body)
+{
+    double elapsed = 0;
+    size_t iterations = 0;
+    prepare();
+    body();
+    while (elapsed < g_minSeconds) {
+        prepare();
+        auto start = Clock::now();
+        for (size_t i = 0; i < BATCH_ITERATIONS; i++) {
+            body();
+        }
+        elapsed += std::chrono::duration<double>(Clock::now() - start).count();
+        iterations += BATCH_ITERATIONS;
+    }
+    BenchResult result { codec, shape, operation, encodedBytes, iterations };
+    result.nsPerOp = elapsed * NS_PER_SECOND / iterations;
+    result.mbPerSecond = encodedBytes * iterations / BYTES_PER_MB / elapsed;
+    g_results.push_back(result);
+}
+
+napi_value CreateString(napi_env env, const std::string& str)
+{
+    napi_value value = nullptr;
+    napi_create_string_utf8(env, str.c_str(), str.size(), &value);
+    return value;
+}
+
+napi_value CreateArray(napi_env env, const std::vector<napi_value>& elements)
+{
+    napi_value array = nullptr;
+    napi_create_array_with_length(env, elements.size(), &array);
+    for (size_t i = 0; i < elements.size(); i++) {
+        napi_set_element(env, array, i, elements[i]);
+    }
+    return array;
+}
+
+std::string ListItem(size_t index)
+{
+    return "item-" + std::to_string(index) + "-lorem-ipsum-dolor-sit";
+}
+
+napi_value CreateNapiNestedMap(napi_env env, size_t depth)
+{
+    napi_value object = nullptr;
+    napi_create_object(env, &object);
+    for (size_t i = 0; i < NESTED_MAP_FANOUT; i++) {
+        napi_value child = nullptr;
+        if (depth > 1) {
+            child = CreateNapiNestedMap(env, depth - 1);
+        } else if (i % 2 == 0) {
+            napi_create_int32(env, static_cast<int32_t>(i), &child);
+        } else {
+            child = CreateString(env, ListItem(i));
+        }
+        napi_set_named_property(env, object, ("key" + std::to_string(i)).c_str(), child);
+    }
+    return object;
+}
+
+CodecableValue CreateCodecableNestedMap(size_t depth)
+{
+    CodecableMap map;
+    for (size_t i = 0; i < NESTED_MAP_FANOUT; i++) {
+        CodecableValue key(std::string("key") + std::to_string(i));
+        if (depth > 1) {
+            map.emplace(key, CreateCodecableNestedMap(depth - 1));
+        } else if (i % 2 == 0) {
+            map.emplace(key, CodecableValue(static_cast<int32_t>(i)));
+        } else {
+            map.emplace(key, CodecableValue(ListItem(i)));
+        }
+    }
+    return CodecableValue(map);
+}
+
+// Cycles through the scalar alternatives of CodecableVariant.
+CodecableValue CreateScalar(size_t index)
+{
+    switch (index % SCALAR_KINDS) {
+        case 0:
+            return CodecableValue(static_cast<int32_t>(index));
+        case 1:
+            return CodecableValue(static_cast<int64_t>(index) << HIGH_WORD_SHIFT);
+        case 2:
+            return CodecableValue(static_cast<double>(index) + SMALL_ARG_DOUBLE);
+        case 3:
+            return CodecableValue(index % 2 == 0);
+        default:
+            return CodecableValue(std::string("s") + std::to_string(index));
+    }
+}
+
+CodecableValue CreateScalarList(size_t size)
+{
+    CodecableList list;
+    list.reserve(size);
+    for (size_t i = 0; i < size; i++) {
+        list.push_back(CreateScalar(i));
+    }
+    return CodecableValue(list);
+}
+
+CodecableValue CreateNestedList()
+{
+    CodecableList list;
+    for (size_t i = 0; i < NESTED_LIST_COUNT; i++) {
+        list.push_back(CreateScalarList(NESTED_LIST_SIZE));
+    }
+    return CodecableValue(list);
+}
+
+NapiRawValue CreateCall(std::vector<napi_value>& args)
+{
+    NapiRawValue call;
+    call.env = g_env;
+    call.argc = static_cast<int>(args.size());
+    call.argValue = args.data();
+    return call;
+}
+
+std::vector<JsonShape> CreateJsonShapes()
+{
+    std::vector<JsonShape> shapes;
+    shapes.push_back({ "small_rpc_args", [](napi_env env) {
+        napi_value number = nullptr;
+        napi_value flag = nullptr;
+        napi_value ratio = nullptr;
+        napi_create_int32(env, SMALL_ARG_INT, &number);
+        napi_get_boolean(env, true, &flag);
+        napi_create_double(env, SMALL_ARG_DOUBLE, &ratio);
+        return std::vector<napi_value> { number, CreateString(env, "getUserInfo"), flag, ratio };
+    } });
+    shapes.push_back({ "large_byte_array", [](napi_env env) {
+        std::vector<napi_value> bytes(JSON_BYTE_ARRAY_SIZE);
+        for (size_t i = 0; i < bytes.size(); i++) {
+            napi_create_int32(env, static_cast<int32_t>(i & BYTE_MASK), &bytes[i]);
+        }
+        return std::vector<napi_value> { CreateArray(env, bytes) };
+    } });
+    shapes.push_back({ "string_list", [](napi_env env) {
+        std::vector<napi_value> strings(STRING_LIST_SIZE);
+        for (size_t i = 0; i < strings.size(); i++) {
+            strings[i] = CreateString(env, ListItem(i));
+        }
+        return std::vector<napi_value> { CreateArray(env, strings) };
+    } });
+    shapes.push_back({ "nested_map", [](napi_env env) {
+        return std::vector<napi_value> { CreateNapiNestedMap(env, NESTED_MAP_DEPTH) };
+    } });
+    return shapes;
+}
+
+std::vector<BinaryShape> CreateBinaryShapes()
+{
+    std::vector<BinaryShape> shapes;
+    shapes.push_back({ "small_rpc_args", CodecableValue(CodecableList { CodecableValue(SMALL_ARG_INT),
+        CodecableValue("getUserInfo"), CodecableValue(true), CodecableValue(SMALL_ARG_DOUBLE) }) });
+    std::vector<uint8_t> bytes(BINARY_BYTE_ARRAY_SIZE);
+    for (size_t i = 0; i < bytes.size(); i++) {
+        bytes[i] = static_cast<uint8_t>(i & BYTE_MASK);
+    }
+    shapes.push_back({ "large_byte_array", CodecableValue(bytes) });
+    std::vector<std::string> strings(STRING_LIST_SIZE);
+    for (size_t i = 0; i < strings.size(); i++) {
+        strings[i] = ListItem(i);
+    }
+    shapes.push_back({ "string_list", CodecableValue(strings) });
+    shapes.push_back({ "nested_map", CreateCodecableNestedMap(NESTED_MAP_DEPTH) });
+    shapes.push_back({ "scalar_list", CreateScalarList(SCALAR_LIST_SIZE) });
+    shapes.push_back({ "nested_list", CreateNestedList() });
+    return shapes;
+}
+
+// The Json DOM conversion the JSON codec used before it wrote and parsed text directly, kept as a baseline.
+std::string DomEncodeCall(napi_env env, const std::vector<napi_value>& args)
+{
+    Json json = Json {};
+    for (size_t i = 0; i < args.size(); i++) {
+        json[std::to_string(i)] = NAPIUtils::PlatformParams(env, args[i]);
+    }
+    return json.dump();
+}
+
+NapiRawValue DomDecodeResult(napi_env env, const std::string& str)
+{
+    NapiRawValue rawValue;
+    Json json = Json::parse(str, nullptr, false);
+    auto it = json.find("errorCode");
+    if (it != json.end()) {
+        rawValue.errorCode = NAPIUtils::NAPI_GetErrorCodeFromJson(*it);
+    }
+    it = json.find("result");
+    rawValue.value = NAPIUtils::NAPI_GetParams(env, it != json.end() ? *it : Json());
+    it = json.find("errorMessage");
+    if (it != json.end()) {
+        rawValue.errorMessage = it->get<std::string>();
+    }
+    return rawValue;
+}
+
+void RunJsonBenchmarks()
+{
+    const BridgeJsonCodec& codec = BridgeJsonCodec::GetInstance();
+    for (const auto& shape : CreateJsonShapes()) {
+        // The mock keeps every napi value until it is reset, so each batch starts from a fresh mock.
+        std::vector<napi_value> args;
+        auto prepare = [&args, &shape]() {
+            MockNapiReset();
+            args = shape.build(g_env);
+        };
+        prepare();
+        size_t callSize = codec.Encode(CreateCall(args))->value.size();
+        Measure("json", shape.name, "encode", callSize, prepare, [&codec, &args]() {
+            codec.Encode(CreateCall(args));
+        });
+
+        // Decoding is measured on a method result carrying the same arguments.
+        NapiRawValue result;
+        result.env = g_env;
+        result.value = CreateArray(g_env, args);
+        result.errorCode = 0;
+        DecodeValue encoded;
+        encoded.env = g_env;
+        encoded.value = codec.Encode(result)->value;
+        Measure("json", shape.name, "decode", encoded.value.size(), MockNapiReset, [&codec, &encoded]() {
+            codec.Decode(encoded);
+        });
+
+        prepare();
+        Measure("json_dom", shape.name, "encode", DomEncodeCall(g_env, args).size(), prepare, [&args]() {
+            DomEncodeCall(g_env, args);
+        });
+        Measure("json_dom", shape.name, "decode", encoded.value.size(), MockNapiReset, [&encoded]() {
+            DomDecodeResult(g_env, encoded.value);
+        });
+    }
+    MockNapiReset();
+}
+
+void RunBinaryBenchmarks()
+{
+    const BridgeBinaryCodec& codec = BridgeBinaryCodec::GetInstance();
+    auto none = []() {};
+    for (const auto& shape : CreateBinaryShapes()) {
+        std::unique_ptr<std::vector<uint8_t>> encoded = codec.Encode(shape.value);
+        size_t size = encoded->size();
+        Measure("binary", shape.name, "encode", size, none, [&codec, &shape]() {
+            codec.Encode(shape.value);
+        });
+        std::vector<uint8_t> buffer(BridgePackager::ComputeEncodedSize(shape.value));
+        Measure("binary", shape.name, "encode_into", size, none, [&codec, &shape, &buffer]() {
+            codec.EncodeBuffer(shape.value, buffer.data(), buffer.size());
+        });
+        Measure("binary", shape.name, "decode", size, none, [&codec, &encoded]() {
+            codec.DecodeBuffer(encoded->data(), encoded->size());
+        });
+        Measure("binary", shape.name, "decode_view", size, none, [&codec, &encoded]() {
+            codec.DecodeBufferView(encoded->data(), encoded->size());
+        });
+    }
+}
+
+void PrintJson()
+{
+    printf("{\"benchmark\":\"bridge_codec\",\"min_time_s\":%g,\"results\":[", g_minSeconds);
+    for (size_t i = 0; i < g_results.size(); i++) {
+        const BenchResult& r = g_results[i];
+        printf("%s\n{\"codec\":\"%s\",\"shape\":\"%s\",\"op\":\"%s\",\"encoded_bytes\":%zu,\"iterations\":%zu,"
+            "\"ns_per_op\":%.1f,\"mb_per_s\":%.2f}", i == 0 ? "" : ",", r.codec.c_str(), r.shape.c_str(),
+            r.operation.c_str(), r.encodedBytes, r.iterations, r.nsPerOp, r.mbPerSecond);
+    }
+    printf("\n]}\n");
+}
+
+void PrintCsv()
+{
+    printf("codec,shape,op,encoded_bytes,iterations,ns_per_op,mb_per_s\n");
+    for (const auto& r : g_results) {
+        printf("%s,%s,%s,%zu,%zu,%.1f,%.2f\n", r.codec.c_str(), r.shape.c_str(), r.operation.c_str(),
+            r.encodedBytes, r.iterations, r.nsPerOp, r.mbPerSecond);
+    }
+}
+} // namespace
+} // namespace OHOS::Plugin::Bridge
+
+int main(int argc, char* argv[])
+{
+    using namespace OHOS::Plugin::Bridge;
+    bool csv = false;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--format=csv") {
+            csv = true;
+        } else if (arg == "--format=json") {
+            csv = false;
+        } else if (arg.rfind("--min-time=", 0) == 0) {
+            g_minSeconds = std::atof(arg.c_str() + strlen("--min-time="));
+        } else {
+            fprintf(stderr, "Usage: %s [--format=json|csv] [--min-time=<seconds>]\n", argv[0]);
+            return 1;
+        }
+    }
+    RunBinaryBenchmarks();
+    RunJsonBenchmarks();
+    if (csv) {
+        PrintCsv();
+    } else {
+        PrintJson();
+    }
+    return 0;
+}
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PLUGINS_BRIDGE_BENCHMARK_ANDROID_LOG_H
+#define PLUGINS_BRIDGE_BENCHMARK_ANDROID_LOG_H
+
+// Host stand-in for the NDK log header used by the integration-test mocks.
+// Logging is dropped so it does not show up in the measurements.
+enum android_LogPriority {
+    ANDROID_LOG_DEBUG = 3,
+    ANDROID_LOG_INFO,
+    ANDROID_LOG_WARN,
+    ANDROID_LOG_ERROR,
+    ANDROID_LOG_FATAL,
+};
+
+inline int __android_log_print(int prio, const char* tag, const char* fmt, ...)
+{
+    (void)prio;
+    (void)tag;
+    (void)fmt;
+    return 0;
+}
+#endif // PLUGINS_BRIDGE_BENCHMARK_ANDROID_LOG_H
@@ -0,0 +1,63 @@
+#!/bin/bash
+# Copyright (c) 2026 Huawei Device Co., Ltd.
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# Builds bridge_codec_benchmark with the host compiler and runs it, without GN.
+#
+# Usage: ./run_benchmark.sh [--format=json|csv] [--min-time=<seconds>]
+#
+# Third-party headers are taken from the source tree next to plugins/ unless
+# overridden:
+#   SECUREC_DIR   bounds_checking_function checkout (include/, src/)
+#   JSON_INCLUDE  directory containing nlohmann/json.hpp
+#   UV_INCLUDE    directory containing uv.h
+#   CXX           host C++ compiler (default g++)
+#   OUT_DIR       build directory (default ${TMPDIR:-/tmp}/bridge_codec_benchmark)
+
+set -euo pipefail
+
+SCRIPT_DIR="$(cd "$(dirname "$0")" && pwd)"
+PLUGINS_DIR="$(cd "${SCRIPT_DIR}/../../.." && pwd)"
+SOURCE_ROOT="$(dirname "${PLUGINS_DIR}")"
+SECUREC_DIR="${SECUREC_DIR:-${SOURCE_ROOT}/third_party/bounds_checking_function}"
+JSON_INCLUDE="${JSON_INCLUDE:-${SOURCE_ROOT}/third_party/json/include}"
+UV_INCLUDE="${UV_INCLUDE:-${SOURCE_ROOT}/third_party/libuv/include}"
+CXX="${CXX:-g++}"
+OUT_DIR="${OUT_DIR:-${TMPDIR:-/tmp}/bridge_codec_benchmark}"
+MOCK_DIR="${PLUGINS_DIR}/test/integration-test/common/cpp"
+CODEC_DIR="${PLUGINS_DIR}/bridge/interfaces/kits/native/src"
+
+mkdir -p "${OUT_DIR}"
+# Sources include headers as "plugins/...", so expose the checkout under that name.
+ln -sfn "${PLUGINS_DIR}" "${OUT_DIR}/plugins"
+
+SECUREC_SOURCES=()
+if [ -d "${SECUREC_DIR}/src" ]; then
+    SECUREC_SOURCES=("${SECUREC_DIR}"/src/*.c)
+    for src in "${SECUREC_SOURCES[@]}"; do
+        cc -O2 -c -I"${SECUREC_DIR}/include" "${src}" -o "${OUT_DIR}/$(basename "${src}" .c).o"
+    done
+fi
+
+"${CXX}" -std=c++17 -O2 -include securec.h \
+    -I"${SCRIPT_DIR}/host_include" -I"${OUT_DIR}" -I"${MOCK_DIR}" -I"${MOCK_DIR}/utils" \
+    -I"${PLUGINS_DIR}/bridge/interfaces/kits/native/include" -I"${PLUGINS_DIR}/bridge/utils/include" \
+    -I"${SECUREC_DIR}/include" -I"${JSON_INCLUDE}" -I"${UV_INCLUDE}" \
+    "${CODEC_DIR}/bridge_binary_codec.cpp" "${CODEC_DIR}/bridge_packager.cpp" "${CODEC_DIR}/codecable_view.cpp" \
+    "${CODEC_DIR}/bridge_json_codec.cpp" "${MOCK_DIR}/napi_mock.cpp" \
+    "${PLUGINS_DIR}/bridge/utils/src/napi_utils.cpp" \
+    "${PLUGINS_DIR}/interfaces/native/inner_api/plugin_utils_napi.cpp" \
+    "${SCRIPT_DIR}/bridge_codec_benchmark.cpp" \
+    $(find "${OUT_DIR}" -maxdepth 1 -name "*.o") \
+    -o "${OUT_DIR}/bridge_codec_benchmark"
+
+"${OUT_DIR}/bridge_codec_benchmark" "$@"
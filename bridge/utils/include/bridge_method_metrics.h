@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PLUGINS_BRIDGE_UTILS_INCLUDE_BRIDGE_METHOD_METRICS_H
+#define PLUGINS_BRIDGE_UTILS_INCLUDE_BRIDGE_METHOD_METRICS_H
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace OHOS::Plugin::Bridge {
+struct BridgeMethodStats {
+    std::string methodName;
+    uint64_t callCount = 0;
+    uint64_t inFlightCount = 0;
+    // Round-trip latency percentiles in microseconds, approximated to 1/8 of their power of two.
+    int64_t p50Latency = 0;
+    int64_t p95Latency = 0;
+    int64_t p99Latency = 0;
+    int64_t maxLatency = 0;
+    // Encoded payload sizes in bytes, whatever the codec of the bridge.
+    uint64_t totalRequestBytes = 0;
+    uint64_t totalResponseBytes = 0;
+    uint64_t maxRequestBytes = 0;
+    uint64_t maxResponseBytes = 0;
+};
+
+/*
+ * Per-method call statistics of one bridge. Latencies go to a log-linear
+ * histogram, so recording a call is constant time and memory does not grow
+ * with the number of calls.
+ */
+class BridgeMethodMetrics {
+public:
+    // Receives every completed call, times are steady-clock microseconds.
+    using TraceListener = std::function<void(const std::string& methodName, int64_t startTime, int64_t endTime)>;
+
+    BridgeMethodMetrics() = default;
+    ~BridgeMethodMetrics() = default;
+
+    void OnCallStart(const std::string& methodName, size_t requestBytes);
+    void OnCallEnd(const std::string& methodName, int64_t startTime, size_t responseBytes);
+    // Ends a call that will never get a result, without recording a latency.
+    void OnCallCancel(const std::string& methodName);
+    std::vector<BridgeMethodStats> GetSnapshot(void);
+    void SetTraceListener(const TraceListener& listener);
+    static int64_t GetSteadyTime(void);
+
+private:
+    static constexpr uint32_t LINEAR_BUCKETS = 16;
+    static constexpr uint32_t SUB_BUCKET_BITS = 3;
+    static constexpr uint32_t MAX_EXPONENT = 40;
+    static constexpr uint32_t BUCKET_COUNT =
+        LINEAR_BUCKETS + (MAX_EXPONENT - SUB_BUCKET_BITS) * (1U << SUB_BUCKET_BITS);
+
+    struct MethodRecord {
+        BridgeMethodStats stats;
+        uint64_t latencyCount = 0;
+        std::array<uint32_t, BUCKET_COUNT> buckets {};
+    };
+
+    std::map<std::string, MethodRecord> records_;
+    std::mutex recordsLock_;
+    TraceListener traceListener_;
+
+    static uint32_t GetBucketIndex(int64_t latency);
+    static int64_t GetBucketValue(uint32_t index);
+    static int64_t GetPercentile(const MethodRecord& record, uint32_t percent);
+};
+} // namespace OHOS::Plugin::Bridge
+#endif // PLUGINS_BRIDGE_UTILS_INCLUDE_BRIDGE_METHOD_METRICS_H
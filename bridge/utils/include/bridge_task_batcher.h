@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PLUGINS_BRIDGE_UTILS_INCLUDE_BRIDGE_TASK_BATCHER_H
+#define PLUGINS_BRIDGE_UTILS_INCLUDE_BRIDGE_TASK_BATCHER_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "bridge_event_handle.h"
+
+namespace OHOS::Plugin::Bridge {
+struct BridgeBatchStats {
+    uint64_t flushCount = 0;
+    uint64_t taskCount = 0;
+    uint64_t lastBatchSize = 0;
+    uint64_t maxBatchSize = 0;
+    // Time from the first queued task of a batch to the start of its flush, in microseconds.
+    int64_t lastFlushLatency = 0;
+    int64_t maxFlushLatency = 0;
+    int64_t totalFlushLatency = 0;
+};
+
+/*
+ * Coalesces the tasks posted to the bridge thread. The first task of a batch
+ * schedules one flush; tasks queued before it runs are executed by the same
+ * flush in posting order, so a burst of calls costs a single bridge-thread post.
+ */
+class BridgeTaskBatcher : public std::enable_shared_from_this<BridgeTaskBatcher> {
+public:
+    explicit BridgeTaskBatcher(std::shared_ptr<BridgeEventHandle> taskExecutor);
+    ~BridgeTaskBatcher() = default;
+
+    static std::shared_ptr<BridgeTaskBatcher> Create(std::shared_ptr<BridgeEventHandle> taskExecutor);
+    void PostTask(const Task& task);
+    BridgeBatchStats GetStats(void);
+
+private:
+    std::shared_ptr<BridgeEventHandle> taskExecutor_;
+    std::vector<Task> pendingTasks_;
+    std::mutex pendingTasksLock_;
+    bool flushScheduled_ = false;
+    int64_t batchStartTime_ = 0;
+    BridgeBatchStats stats_;
+
+    void Flush(void);
+    static int64_t GetSteadyTime(void);
+};
+} // namespace OHOS::Plugin::Bridge
+#endif // PLUGINS_BRIDGE_UTILS_INCLUDE_BRIDGE_TASK_BATCHER_H
@@ -34,6 +34,8 @@ enum class ErrorCode {
     BRIDGE_CODEC_TYPE_MISMATCH,
     BRIDGE_CODEC_INVALID,
     BRIDGE_CALL_METHOD_SYNC_TIMEOUT,
+    BRIDGE_STREAM_NO_CREDIT,
+    BRIDGE_STREAM_CLOSED,
     BRIDGE_END
 };
 
@@ -51,7 +53,9 @@ static constexpr const char* CodeMessage[static_cast<int>(ErrorCode::BRIDGE_END)
     "Data exceeds safe integer",
     "Bridge codec type mismatch",
     "Bridge codec is invalid",
-    "Bridge callMethodSync timeout!"
+    "Bridge callMethodSync timeout!",
+    "Bridge stream has no credit!",
+    "Bridge stream is closed!"
 };
 } // namespace OHOS::Plugin::Bridge
 #endif
\ No newline at end of file
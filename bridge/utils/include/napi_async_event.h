@@ -72,7 +72,7 @@ public:
     void AsyncWorkMessage(void);
 
     napi_value AsyncWorkCallMethodSync(const std::string& parameter);
-    napi_value AsyncWorkCallMethodSyncBinary(uint8_t* data, size_t size);
+    napi_value AsyncWorkCallMethodSyncBinary(const uint8_t* data, size_t size);
 
 private:
     napi_env env_ = nullptr;
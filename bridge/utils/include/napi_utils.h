@@ -17,6 +17,8 @@
 #define PLUGINS_BRIDGE_NAPI_UTILS_H
 
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "error_code.h"
 #include "napi/native_api.h"
@@ -25,6 +27,7 @@
 
 namespace OHOS::Plugin::Bridge {
 using Json = nlohmann::json;
+using NapiJsonMembers = std::vector<std::pair<std::string, napi_value>>;
 
 class ScopedHandleScope {
 public:
@@ -51,6 +54,12 @@ class NAPIUtils {
 public:
     static bool JsonStringToNapiValues(napi_env env, const std::string& str, size_t& argc, napi_value* argv);
     static bool NapiValuesToJsonString(napi_env env, const size_t& argc, const napi_value* argv, std::string& str);
+    // Parses the members of a top-level JSON object straight into napi values, no Json DOM is built.
+    static bool JsonStringToNapiMembers(napi_env env, const std::string& str, NapiJsonMembers& members);
+    static napi_value FindJsonMember(const NapiJsonMembers& members, const std::string& key);
+    // Serializes a napi value as JSON text with the same value mapping as PlatformParams.
+    static void AppendNapiValueToJson(napi_env env, napi_value value, std::string& str);
+    static void AppendJsonString(const std::string& value, std::string& str);
     static napi_value NAPI_GetParams(napi_env env, Json json);
     static Json PlatformParams(napi_env env, napi_value value);
     static int NAPI_GetErrorCodeFromJson(Json json);
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bridge_method_metrics.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace OHOS::Plugin::Bridge {
+namespace {
+constexpr uint32_t PERCENT_50 = 50;
+constexpr uint32_t PERCENT_95 = 95;
+constexpr uint32_t PERCENT_99 = 99;
+constexpr uint32_t PERCENT_100 = 100;
+} // namespace
+
+int64_t BridgeMethodMetrics::GetSteadyTime(void)
+{
+    auto curNow = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(curNow.time_since_epoch()).count();
+}
+
+void BridgeMethodMetrics::OnCallStart(const std::string& methodName, size_t requestBytes)
+{
+    std::lock_guard<std::mutex> lock(recordsLock_);
+    auto& stats = records_[methodName].stats;
+    stats.callCount++;
+    stats.inFlightCount++;
+    stats.totalRequestBytes += requestBytes;
+    stats.maxRequestBytes = std::max<uint64_t>(stats.maxRequestBytes, requestBytes);
+}
+
+void BridgeMethodMetrics::OnCallEnd(const std::string& methodName, int64_t startTime, size_t responseBytes)
+{
+    int64_t endTime = GetSteadyTime();
+    int64_t latency = std::max<int64_t>(endTime - startTime, 0);
+    TraceListener listener;
+    {
+        std::lock_guard<std::mutex> lock(recordsLock_);
+        auto& record = records_[methodName];
+        auto& stats = record.stats;
+        if (stats.inFlightCount > 0) {
+            stats.inFlightCount--;
+        }
+        stats.totalResponseBytes += responseBytes;
+        stats.maxResponseBytes = std::max<uint64_t>(stats.maxResponseBytes, responseBytes);
+        stats.maxLatency = std::max(stats.maxLatency, latency);
+        record.buckets[GetBucketIndex(latency)]++;
+        record.latencyCount++;
+        listener = traceListener_;
+    }
+    if (listener) {
+        listener(methodName, startTime, endTime);
+    }
+}
+
+void BridgeMethodMetrics::OnCallCancel(const std::string& methodName)
+{
+    std::lock_guard<std::mutex> lock(recordsLock_);
+    auto iter = records_.find(methodName);
+    if (iter != records_.end() && iter->second.stats.inFlightCount > 0) {
+        iter->second.stats.inFlightCount--;
+    }
+}
+
+std::vector<BridgeMethodStats> BridgeMethodMetrics::GetSnapshot(void)
+{
+    std::vector<BridgeMethodStats> snapshot;
+    std::lock_guard<std::mutex> lock(recordsLock_);
+    snapshot.reserve(records_.size());
+    for (const auto& [methodName, record] : records_) {
+        BridgeMethodStats stats = record.stats;
+        stats.methodName = methodName;
+        stats.p50Latency = GetPercentile(record, PERCENT_50);
+        stats.p95Latency = GetPercentile(record, PERCENT_95);
+        stats.p99Latency = GetPercentile(record, PERCENT_99);
+        snapshot.push_back(std::move(stats));
+    }
+    return snapshot;
+}
+
+void BridgeMethodMetrics::SetTraceListener(const TraceListener& listener)
+{
+    std::lock_guard<std::mutex> lock(recordsLock_);
+    traceListener_ = listener;
+}
+
+uint32_t BridgeMethodMetrics::GetBucketIndex(int64_t latency)
+{
+    if (latency < static_cast<int64_t>(LINEAR_BUCKETS)) {
+        return static_cast<uint32_t>(std::max<int64_t>(latency, 0));
+    }
+    uint64_t value = static_cast<uint64_t>(latency);
+    uint32_t exponent = 0;
+    while ((value >> (exponent + 1)) != 0) {
+        exponent++;
+    }
+    // Values in [2^e, 2^(e+1)) are split into 2^SUB_BUCKET_BITS equal buckets.
+    uint32_t subBucket = static_cast<uint32_t>(value >> (exponent - SUB_BUCKET_BITS)) & ((1U << SUB_BUCKET_BITS) - 1);
+    uint32_t index = LINEAR_BUCKETS + (exponent - (SUB_BUCKET_BITS + 1)) * (1U << SUB_BUCKET_BITS) + subBucket;
+    return std::min(index, BUCKET_COUNT - 1);
+}
+
+int64_t BridgeMethodMetrics::GetBucketValue(uint32_t index)
+{
+    if (index < LINEAR_BUCKETS) {
+        return index;
+    }
+    uint32_t offset = index - LINEAR_BUCKETS;
+    uint32_t exponent = offset / (1U << SUB_BUCKET_BITS) + SUB_BUCKET_BITS + 1;
+    uint32_t subBucket = offset % (1U << SUB_BUCKET_BITS);
+    int64_t width = static_cast<int64_t>(1) << (exponent - SUB_BUCKET_BITS);
+    return (static_cast<int64_t>((1U << SUB_BUCKET_BITS) + subBucket) * width) + width / 2;
+}
+
+int64_t BridgeMethodMetrics::GetPercentile(const MethodRecord& record, uint32_t percent)
+{
+    if (record.latencyCount == 0) {
+        return 0;
+    }
+    uint64_t target = (record.latencyCount * percent + PERCENT_100 - 1) / PERCENT_100;
+    uint64_t seen = 0;
+    for (uint32_t i = 0; i < BUCKET_COUNT; i++) {
+        seen += record.buckets[i];
+        if (seen >= target) {
+            return std::min(GetBucketValue(i), record.stats.maxLatency);
+        }
+    }
+    return record.stats.maxLatency;
+}
+} // namespace OHOS::Plugin::Bridge
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bridge_task_batcher.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "log.h"
+
+namespace OHOS::Plugin::Bridge {
+BridgeTaskBatcher::BridgeTaskBatcher(std::shared_ptr<BridgeEventHandle> taskExecutor)
+    : taskExecutor_(taskExecutor)
+{
+}
+
+std::shared_ptr<BridgeTaskBatcher> BridgeTaskBatcher::Create(std::shared_ptr<BridgeEventHandle> taskExecutor)
+{
+    return std::make_shared<BridgeTaskBatcher>(taskExecutor);
+}
+
+int64_t BridgeTaskBatcher::GetSteadyTime(void)
+{
+    auto curNow = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(curNow.time_since_epoch()).count();
+}
+
+void BridgeTaskBatcher::PostTask(const Task& task)
+{
+    if (task == nullptr) {
+        return;
+    }
+    if (!taskExecutor_) {
+        LOGE("BridgeTaskBatcher: taskExecutor_ is null.");
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(pendingTasksLock_);
+        pendingTasks_.push_back(task);
+        if (flushScheduled_) {
+            return;
+        }
+        flushScheduled_ = true;
+        batchStartTime_ = GetSteadyTime();
+    }
+    // The flush owns the batcher, so the queued tasks still run after the bridge has dropped it.
+    auto batcher = shared_from_this();
+    taskExecutor_->RunTaskOnBridgeThread([batcher]() { batcher->Flush(); });
+}
+
+void BridgeTaskBatcher::Flush(void)
+{
+    std::vector<Task> tasks;
+    {
+        std::lock_guard<std::mutex> lock(pendingTasksLock_);
+        tasks.swap(pendingTasks_);
+        flushScheduled_ = false;
+
+        int64_t latency = GetSteadyTime() - batchStartTime_;
+        stats_.flushCount++;
+        stats_.taskCount += tasks.size();
+        stats_.lastBatchSize = tasks.size();
+        stats_.maxBatchSize = std::max<uint64_t>(stats_.maxBatchSize, tasks.size());
+        stats_.lastFlushLatency = latency;
+        stats_.maxFlushLatency = std::max(stats_.maxFlushLatency, latency);
+        stats_.totalFlushLatency += latency;
+    }
+
+    for (const auto& task : tasks) {
+        task();
+    }
+}
+
+BridgeBatchStats BridgeTaskBatcher::GetStats(void)
+{
+    std::lock_guard<std::mutex> lock(pendingTasksLock_);
+    return stats_;
+}
+} // namespace OHOS::Plugin::Bridge
@@ -352,7 +352,7 @@ napi_value NAPIAsyncEvent::AsyncWorkCallMethodSync(const std::string& parameter)
     return methodResultValue;
 }
 
-napi_value NAPIAsyncEvent::AsyncWorkCallMethodSyncBinary(uint8_t* data, size_t size)
+napi_value NAPIAsyncEvent::AsyncWorkCallMethodSyncBinary(const uint8_t* data, size_t size)
 {
     LOGD("NAPIAsyncEvent::AsyncWorkCallMethodSyncBinary called, size=%{public}zu", size);
     SetErrorCode(0);
@@ -375,7 +375,7 @@ napi_value NAPIAsyncEvent::AsyncWorkCallMethodSyncBinary(uint8_t* data, size_t s
         return methodResultValue;
     }
 
-    auto decoded = BridgeBinaryCodec::GetInstance().DecodeBuffer(data, size);
+    auto decoded = BridgeBinaryCodec::GetInstance().DecodeBufferView(data, size);
     if (!decoded) {
         LOGE("AsyncWorkCallMethodSyncBinary: Decode buffer failed");
         return nullptr;
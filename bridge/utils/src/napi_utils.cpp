@@ -15,20 +15,197 @@
 
 #include "napi_utils.h"
 
+#include <climits>
 #include <cmath>
+#include <cstdio>
+#include <cstdlib>
 
 #include "plugins/interfaces/native/inner_api/plugin_utils_napi.h"
 #include "plugins/interfaces/native/plugin_utils.h"
 
 namespace OHOS::Plugin::Bridge {
 static constexpr double DOUBLE_MIN_VALUE = 0.00001;
+static constexpr size_t JSON_RESERVE_PER_ARG = 32;
+static constexpr size_t JSON_DOUBLE_BUF_SIZE = 32;
+static constexpr int JSON_DOUBLE_SHORT_PRECISION = 15;
+static constexpr int JSON_DOUBLE_FULL_PRECISION = 17;
+
+namespace {
+napi_value CreateNumberValue(napi_env env, double doubleValue, int intValue)
+{
+    double diff = std::fabs(doubleValue - static_cast<double>(intValue));
+    if (diff < DOUBLE_MIN_VALUE) {
+        return PluginUtilsNApi::CreateInt32(env, intValue);
+    }
+    return PluginUtilsNApi::CreateDouble(env, doubleValue);
+}
+
+int DoubleToInt(double value)
+{
+    if (value >= static_cast<double>(INT_MIN) && value <= static_cast<double>(INT_MAX)) {
+        return static_cast<int>(value);
+    }
+    return INT_MIN;
+}
+
+void AppendJsonDouble(double value, std::string& str)
+{
+    if (!std::isfinite(value)) {
+        str += "null";
+        return;
+    }
+    char buffer[JSON_DOUBLE_BUF_SIZE] = { 0 };
+    int len = snprintf(buffer, sizeof(buffer), "%.*g", JSON_DOUBLE_SHORT_PRECISION, value);
+    if (len > 0 && std::strtod(buffer, nullptr) != value) {
+        len = snprintf(buffer, sizeof(buffer), "%.*g", JSON_DOUBLE_FULL_PRECISION, value);
+    }
+    if (len <= 0 || static_cast<size_t>(len) >= sizeof(buffer)) {
+        str += "null";
+        return;
+    }
+    str.append(buffer, len);
+    // Keep integral doubles typed as floating point on the platform side, as Json::dump does.
+    if (str.find_first_of(".eE", str.size() - len) == std::string::npos) {
+        str += ".0";
+    }
+}
+
+/*
+ * SAX consumer of nlohmann::json::sax_parse that creates napi values while the
+ * text is scanned. Members of the top-level object are handed out individually,
+ * so callers pick their arguments without looking them up on a napi object.
+ */
+class NapiJsonSax {
+public:
+    NapiJsonSax(napi_env env, NapiJsonMembers& members) : env_(env), members_(members) {}
+
+    bool null()
+    {
+        return AddValue(PluginUtilsNApi::CreateNull(env_));
+    }
+
+    bool boolean(bool value)
+    {
+        return AddValue(PluginUtilsNApi::CreateBoolean(env_, value));
+    }
+
+    bool number_integer(Json::number_integer_t value)
+    {
+        return AddValue(CreateNumberValue(env_, static_cast<double>(value), static_cast<int>(value)));
+    }
+
+    bool number_unsigned(Json::number_unsigned_t value)
+    {
+        return AddValue(CreateNumberValue(env_, static_cast<double>(value), static_cast<int>(value)));
+    }
+
+    bool number_float(Json::number_float_t value, const Json::string_t& /* text */)
+    {
+        return AddValue(CreateNumberValue(env_, value, DoubleToInt(value)));
+    }
+
+    bool string(Json::string_t& value)
+    {
+        return AddValue(PluginUtilsNApi::CreateStringUtf8(env_, value));
+    }
+
+    bool binary(Json::binary_t& /* value */)
+    {
+        return AddValue(PluginUtilsNApi::CreateNull(env_));
+    }
+
+    bool start_object(size_t /* elements */)
+    {
+        Frame frame;
+        frame.isMembers = frames_.empty();
+        if (!frame.isMembers) {
+            frame.container = PluginUtilsNApi::CreateObject(env_);
+        }
+        frames_.push_back(std::move(frame));
+        return true;
+    }
+
+    bool key(Json::string_t& value)
+    {
+        frames_.back().key = std::move(value);
+        return true;
+    }
+
+    bool end_object()
+    {
+        return EndContainer();
+    }
+
+    bool start_array(size_t /* elements */)
+    {
+        Frame frame;
+        frame.container = PluginUtilsNApi::CreateArray(env_);
+        frame.isArray = true;
+        frames_.push_back(std::move(frame));
+        return true;
+    }
+
+    bool end_array()
+    {
+        return EndContainer();
+    }
+
+    bool parse_error(size_t /* position */, const std::string& /* token */,
+        const nlohmann::detail::exception& /* ex */)
+    {
+        return false;
+    }
+
+private:
+    struct Frame {
+        napi_value container = nullptr;
+        std::string key;
+        uint32_t index = 0;
+        bool isArray = false;
+        bool isMembers = false;
+    };
+
+    bool AddValue(napi_value value)
+    {
+        if (frames_.empty()) {
+            return true;
+        }
+        Frame& frame = frames_.back();
+        if (frame.isMembers) {
+            members_.emplace_back(std::move(frame.key), value);
+        } else if (frame.isArray) {
+            PluginUtilsNApi::SetSelementToArray(env_, frame.container, frame.index++, value);
+        } else {
+            PluginUtilsNApi::SetNamedProperty(env_, frame.container, frame.key, value);
+        }
+        return true;
+    }
+
+    bool EndContainer()
+    {
+        napi_value container = frames_.back().container;
+        bool isMembers = frames_.back().isMembers;
+        frames_.pop_back();
+        return isMembers ? true : AddValue(container);
+    }
+
+    napi_env env_ = nullptr;
+    NapiJsonMembers& members_;
+    std::vector<Frame> frames_;
+};
+} // namespace
 
 bool NAPIUtils::JsonStringToNapiValues(napi_env env, const std::string& str, size_t& argc, napi_value* argv)
 {
+    NapiJsonMembers members;
+    JsonStringToNapiMembers(env, str, members);
     size_t argNum = 0;
-    Json json = Json::parse(str, nullptr, false);
-    while (json.find(std::to_string(argNum)) != json.end() && argNum < argc) {
-        argv[argNum] = NAPI_GetParams(env, json.at(std::to_string(argNum)));
+    while (argNum < argc) {
+        napi_value value = FindJsonMember(members, std::to_string(argNum));
+        if (value == nullptr) {
+            break;
+        }
+        argv[argNum] = value;
         argNum++;
     }
     argc = argNum;
@@ -38,14 +215,149 @@ bool NAPIUtils::JsonStringToNapiValues(napi_env env, const std::string& str, siz
 bool NAPIUtils::NapiValuesToJsonString(napi_env env, const size_t& argc,
     const napi_value* argv, std::string& str)
 {
-    Json json = Json {};
+    str.clear();
+    str.reserve(argc * JSON_RESERVE_PER_ARG);
+    str += '{';
     for (size_t i = 0; i < argc; i++) {
-        json[std::to_string(i)] = PlatformParams(env, argv[i]);
+        if (i > 0) {
+            str += ',';
+        }
+        AppendJsonString(std::to_string(i), str);
+        str += ':';
+        AppendNapiValueToJson(env, argv[i], str);
     }
-    str = json.dump();
+    str += '}';
     return true;
 }
 
+bool NAPIUtils::JsonStringToNapiMembers(napi_env env, const std::string& str, NapiJsonMembers& members)
+{
+    members.clear();
+    NapiJsonSax sax(env, members);
+    if (!Json::sax_parse(str, &sax)) {
+        members.clear();
+        return false;
+    }
+    return true;
+}
+
+napi_value NAPIUtils::FindJsonMember(const NapiJsonMembers& members, const std::string& key)
+{
+    // Json objects keep the last of duplicated keys, so search from the back.
+    for (auto iter = members.rbegin(); iter != members.rend(); ++iter) {
+        if (iter->first == key) {
+            return iter->second;
+        }
+    }
+    return nullptr;
+}
+
+void NAPIUtils::AppendJsonString(const std::string& value, std::string& str)
+{
+    static constexpr const char* hexDigits = "0123456789abcdef";
+    static constexpr uint8_t hexShift = 4;
+    static constexpr uint8_t hexMask = 0x0F;
+    static constexpr uint8_t controlEnd = 0x20;
+    str += '"';
+    for (char ch : value) {
+        switch (ch) {
+            case '"':
+                str += "\\\"";
+                break;
+            case '\\':
+                str += "\\\\";
+                break;
+            case '\b':
+                str += "\\b";
+                break;
+            case '\f':
+                str += "\\f";
+                break;
+            case '\n':
+                str += "\\n";
+                break;
+            case '\r':
+                str += "\\r";
+                break;
+            case '\t':
+                str += "\\t";
+                break;
+            default:
+                if (static_cast<uint8_t>(ch) < controlEnd) {
+                    str += "\\u00";
+                    str += hexDigits[static_cast<uint8_t>(ch) >> hexShift];
+                    str += hexDigits[static_cast<uint8_t>(ch) & hexMask];
+                } else {
+                    str += ch;
+                }
+                break;
+        }
+    }
+    str += '"';
+}
+
+void NAPIUtils::AppendNapiValueToJson(napi_env env, napi_value value, std::string& str)
+{
+    napi_valuetype valueType = PluginUtilsNApi::GetValueType(env, value);
+    switch (valueType) {
+        case napi_boolean: {
+            str += PluginUtilsNApi::GetBool(env, value) ? "true" : "false";
+            return;
+        }
+        case napi_number: {
+            int intValue = PluginUtilsNApi::GetCInt32(value, env);
+            double numberValue = PluginUtilsNApi::GetDouble(env, value);
+            double diff = std::fabs(numberValue - static_cast<double>(intValue));
+            if (diff > DOUBLE_MIN_VALUE) {
+                AppendJsonDouble(numberValue, str);
+            } else {
+                str += std::to_string(intValue);
+            }
+            return;
+        }
+        case napi_string: {
+            AppendJsonString(PluginUtilsNApi::GetStringFromValueUtf8(env, value), str);
+            return;
+        }
+        case napi_object: {
+            if (PluginUtilsNApi::IsArray(env, value)) {
+                uint32_t length = 0;
+                napi_get_array_length(env, value, &length);
+                str += '[';
+                for (uint32_t i = 0; i < length; i++) {
+                    napi_value elementValue = nullptr;
+                    napi_get_element(env, value, i, &elementValue);
+                    if (i > 0) {
+                        str += ',';
+                    }
+                    AppendNapiValueToJson(env, elementValue, str);
+                }
+                str += ']';
+                return;
+            }
+            // An object without properties stays null, as in PlatformParams.
+            std::vector<std::string> props;
+            if (!PluginUtilsNApi::GetPropertyNames(env, value, props) || props.empty()) {
+                break;
+            }
+            str += '{';
+            for (size_t i = 0; i < props.size(); i++) {
+                if (i > 0) {
+                    str += ',';
+                }
+                AppendJsonString(props[i], str);
+                str += ':';
+                AppendNapiValueToJson(env, PluginUtilsNApi::GetNamedProperty(env, value, props[i]), str);
+            }
+            str += '}';
+            return;
+        }
+        default:
+            break;
+    }
+    str += "null";
+}
+
 napi_value NAPIUtils::NAPI_GetParams(napi_env env, Json json)
 {
     napi_value result = nullptr;
@@ -101,6 +101,7 @@ public:
     static bool IsArrayBuffer(napi_env env, napi_value value);
     static bool GetArrayBuffer(napi_env env, napi_value value, std::vector<uint8_t>& vector);
     static napi_value CreateArrayBuffer(napi_env env, const std::vector<uint8_t>& value);
+    static napi_value CreateArrayBuffer(napi_env env, const uint8_t* data, size_t size);
     static napi_status SetEnumItem(napi_env env, napi_value object, const char* name, int32_t value);
     static bool DetachArrayBufferFromTypedArray(napi_env env, napi_value value);
 };
@@ -15,7 +15,9 @@
 
 #include "http_exec.h"
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdlib>
 #include <cstring>
 #include <memory>
 #include <thread>
@@ -57,8 +59,14 @@
 namespace OHOS::NetStack::Http {
 static constexpr int CURL_TIMEOUT_MS = 50;
 static constexpr int CONDITION_TIMEOUT_S = 3600;
-static constexpr int CURL_MAX_WAIT_MSECS = 10;
-static constexpr int CURL_HANDLE_NUM = 10;
+static constexpr int CURL_MAX_WAIT_MSECS = 1000;
+static constexpr size_t STREAM_BUFFER_CAPACITY = 256 * 1024;
+static constexpr size_t STREAM_FLUSH_THRESHOLD = 64 * 1024;
+static constexpr int STREAM_FLUSH_INTERVAL_MS = 20;
+static constexpr int DECIMAL_BASE = 10;
+static constexpr const char *HTTP_CONTENT_LENGTH = "content-length";
+static constexpr const char *HTTP_CONTENT_ENCODING = "content-encoding";
+static constexpr const char *HTTP_CONTENT_ENCODING_IDENTITY = "identity";
 static constexpr const uint32_t EVENT_PARAM_ZERO = 0;
 static constexpr const uint32_t EVENT_PARAM_ONE = 1;
 static constexpr const uint32_t EVENT_PARAM_TWO = 2;
@@ -87,6 +95,7 @@ static void RequestContextDeleter(RequestContext *context)
         HttpExec::staticContextSet_.contextSet.erase(it);
     }
 
+    HttpExec::ReleaseMappedBody(context);
     context->DeleteReference();
     delete context;
     context = nullptr;
@@ -183,8 +192,10 @@ bool HttpExec::AddCurlHandle(CURL *handle, RequestContext *context)
     std::thread([context, handle] {
         std::lock_guard guard(staticVariable_.curlMultiMutex);
         SetServerSSLCertOption(handle, context);
-        staticVariable_.infoQueue.emplace(context, handle);
+        staticVariable_.infoQueue.emplace(context, handle, staticVariable_.requestSequence++);
         staticVariable_.conditionVariable.notify_all();
+        // The worker may be blocked in curl_multi_poll without the lock, wake it to add the handle now.
+        (void)curl_multi_wakeup(staticVariable_.curlMulti);
         {
             std::lock_guard lockGuard(staticContextSet_.mutexForContextVec);
             HttpExec::staticContextSet_.contextSet.emplace(context);
@@ -204,7 +215,7 @@ bool HttpExec::RequestWithoutCache(RequestContext *context)
         return false;
     }
 
-    auto handle = curl_easy_init();
+    auto handle = AcquireCurlHandle();
     if (!handle) {
         NETSTACK_LOGE("Failed to create fetch task");
         return false;
@@ -223,13 +234,18 @@ bool HttpExec::RequestWithoutCache(RequestContext *context)
 
     if (!SetOption(handle, context, context->GetCurlHeaderList())) {
         NETSTACK_LOGE("set option failed");
+        ReleaseCurlHandle(handle);
         return false;
     }
 
     context->response.SetRequestTime(HttpTime::GetNowTimeGMT());
 
+    if (context->IsRequestInStream()) {
+        RegisterStream(context, handle);
+    }
     if (!AddCurlHandle(handle, context)) {
         NETSTACK_LOGE("add handle failed");
+        UnregisterStream(context);
         return false;
     }
 
@@ -261,6 +277,7 @@ bool HttpExec::GetCurlDataFromHandle(CURL *handle, RequestContext *context, CURL
     context->response.SetResponseCode(responseCode);
     if (context->response.GetResponseCode() == static_cast<uint32_t>(ResponseCode::NOT_MODIFIED)) {
         NETSTACK_LOGI("cache is NOT_MODIFIED, we use the cache");
+        ReleaseMappedBody(context);
         context->SetResponseByCache();
         return true;
     }
@@ -340,7 +357,8 @@ void HttpExec::HandleCurlData(CURLMsg *msg)
     NETSTACK_LOGI("priority = %{public}d", context->options.GetPriority());
     context->SetExecOK(GetCurlDataFromHandle(handle, context, msg->msg, msg->data.result));
     CacheCurlPerformanceTiming(handle, context);
-    if (context->IsExecOK()) {
+    // A mapped body never went through the response string, so there is nothing to cache.
+    if (context->IsExecOK() && !HasMappedBody(context)) {
         CacheProxy proxy(context->options);
         proxy.WriteResponseToCache(context->response);
     }
@@ -350,8 +368,8 @@ void HttpExec::HandleCurlData(CURLMsg *msg)
     }
 
     if (context->IsRequestInStream()) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(CURL_TIMEOUT_MS));
-        NapiUtils::CreateUvQueueWorkEnhanced(context->GetEnv(), context, AsyncWorkRequestInStreamCallback);
+        // The rest of the buffered body is delivered by OnStreamEnd before the completion callback.
+        NapiUtils::CreateUvQueueWorkEnhanced(context->GetEnv(), context, OnStreamEnd);
     } else {
         NapiUtils::CreateUvQueueWorkEnhanced(context->GetEnv(), context, AsyncWorkRequestCallback);
     }
@@ -413,8 +431,15 @@ napi_value HttpExec::BuildRequestCallback(RequestContext *context)
         context->response.GetHeader())[HttpConstant::HTTP_CONTENT_TYPE]);
     if (contentType.find(HttpConstant::HTTP_CONTENT_TYPE_OCTET_STREAM) != std::string::npos ||
         contentType.find(HttpConstant::HTTP_CONTENT_TYPE_IMAGE) != std::string::npos) {
+        napi_value mappedBody = TakeMappedBody(context);
+        if (mappedBody != nullptr) {
+            NapiUtils::SetNamedProperty(context->GetEnv(), object, HttpConstant::RESPONSE_KEY_RESULT, mappedBody);
+            NapiUtils::SetUint32Property(context->GetEnv(), object, HttpConstant::RESPONSE_KEY_RESULT_TYPE,
+                                         static_cast<uint32_t>(HttpDataType::ARRAY_BUFFER));
+            return object;
+        }
         void *data = nullptr;
-        auto body = context->response.GetResult();
+        const auto &body = context->response.GetResult();
         napi_value arrayBuffer = NapiUtils::CreateArrayBuffer(context->GetEnv(), body.size(), &data);
         if (data != nullptr && arrayBuffer != nullptr) {
             if (memcpy_s(data, body.size(), body.c_str(), body.size()) != EOK) {
@@ -506,11 +531,27 @@ bool HttpExec::EncodeUrlParam(std::string &str)
     return true;
 }
 
+bool HttpExec::CanAdmitRequest(const ConnectionPolicy &policy)
+{
+    if (staticVariable_.infoQueue.empty()) {
+        return false;
+    }
+    if (policy.maxActiveRequests == 0) {
+        return true;
+    }
+    // The queue is ordered by priority, if its head has to wait so does everything behind it.
+    size_t limit = policy.maxActiveRequests;
+    if (staticVariable_.infoQueue.top().context->options.GetPriority() < policy.highPriority) {
+        limit = std::max<size_t>(limit - std::min(limit, policy.reservedHighPrioritySlots), 1);
+    }
+    return staticVariable_.contextMap.size() < limit;
+}
+
 void HttpExec::AddRequestInfo()
 {
+    auto policy = GetConnectionPolicy();
     std::lock_guard guard(staticVariable_.curlMultiMutex);
-    int num = 0;
-    while (!staticVariable_.infoQueue.empty()) {
+    while (CanAdmitRequest(policy)) {
         if (!staticVariable_.runThread || staticVariable_.curlMulti == nullptr) {
             break;
         }
@@ -521,11 +562,6 @@ void HttpExec::AddRequestInfo()
         if (ret == CURLM_OK) {
             staticVariable_.contextMap[info.handle] = info.context;
         }
-
-        ++num;
-        if (num >= CURL_HANDLE_NUM) {
-            break;
-        }
     }
 }
 
@@ -549,43 +585,297 @@ bool HttpExec::IsContextDeleted(RequestContext *context)
 void HttpExec::RunThread()
 {
     while (staticVariable_.runThread && staticVariable_.curlMulti != nullptr) {
+        ApplyPendingMultiOption();
         AddRequestInfo();
+        ResumeStreams();
         SendRequest();
         ReadResponse();
-        std::this_thread::sleep_for(std::chrono::milliseconds(CURL_TIMEOUT_MS));
-        std::unique_lock l(staticVariable_.curlMultiMutex);
-        staticVariable_.conditionVariable.wait_for(l, std::chrono::seconds(CONDITION_TIMEOUT_S), [] {
-            return !staticVariable_.infoQueue.empty() || !staticVariable_.contextMap.empty();
-        });
+        FlushIdleStreams();
+        WaitForEvents();
     }
 }
 
 void HttpExec::SendRequest()
 {
     std::lock_guard guard(staticVariable_.curlMultiMutex);
+    if (!staticVariable_.runThread || staticVariable_.curlMulti == nullptr) {
+        return;
+    }
 
     int runningHandle = 0;
-    int num = 0;
-    do {
-        if (!staticVariable_.runThread || staticVariable_.curlMulti == nullptr) {
-            break;
+    auto ret = curl_multi_perform(staticVariable_.curlMulti, &runningHandle);
+    if (ret != CURLM_OK) {
+        NETSTACK_LOGE("curl_multi_perform failed %{public}d", ret);
+    }
+}
+
+void HttpExec::WaitForEvents()
+{
+    auto policy = GetConnectionPolicy();
+    {
+        std::unique_lock l(staticVariable_.curlMultiMutex);
+        if (staticVariable_.contextMap.empty()) {
+            // Nothing in flight, sleep until AddCurlHandle or DeInitialize signals.
+            staticVariable_.conditionVariable.wait_for(l, std::chrono::seconds(CONDITION_TIMEOUT_S), [] {
+                return !staticVariable_.infoQueue.empty() || !staticVariable_.runThread;
+            });
+            return;
+        }
+        // Queued requests that have to wait for a free slot are admitted once a transfer completes.
+        if (CanAdmitRequest(policy)) {
+            return;
+        }
+    }
+
+    int timeoutMs = CURL_MAX_WAIT_MSECS;
+    {
+        std::lock_guard guard(staticVariable_.streamMutex);
+        if (!staticVariable_.streamMap.empty()) {
+            timeoutMs = STREAM_FLUSH_INTERVAL_MS;
+        }
+    }
+    // Polled without the lock so new requests can be queued, curl_multi_wakeup ends the wait early.
+    // libcurl also caps the wait at its own next timeout, so retries and timers are not delayed.
+    auto ret = curl_multi_poll(staticVariable_.curlMulti, nullptr, 0, timeoutMs, nullptr);
+    if (ret != CURLM_OK) {
+        NETSTACK_LOGE("curl_multi_poll failed %{public}d", ret);
+    }
+}
+
+void HttpExec::RegisterStream(RequestContext *context, CURL *handle)
+{
+    auto stream = std::make_shared<HttpStreamBuffer>(STREAM_BUFFER_CAPACITY, STREAM_FLUSH_THRESHOLD,
+        std::chrono::milliseconds(STREAM_FLUSH_INTERVAL_MS));
+    std::lock_guard guard(staticVariable_.streamMutex);
+    staticVariable_.streamMap[context] = std::make_pair(handle, stream);
+}
+
+void HttpExec::UnregisterStream(RequestContext *context)
+{
+    std::lock_guard guard(staticVariable_.streamMutex);
+    staticVariable_.streamMap.erase(context);
+}
+
+std::shared_ptr<HttpStreamBuffer> HttpExec::FindStream(RequestContext *context)
+{
+    std::lock_guard guard(staticVariable_.streamMutex);
+    auto it = staticVariable_.streamMap.find(context);
+    if (it == staticVariable_.streamMap.end()) {
+        return nullptr;
+    }
+    return it->second.second;
+}
+
+void HttpExec::ScheduleStreamDelivery(RequestContext *context, const std::shared_ptr<HttpStreamBuffer> &stream)
+{
+    if (stream->TryScheduleDelivery()) {
+        NapiUtils::CreateUvQueueWorkEnhanced(context->GetEnv(), context, OnStreamDataReceive);
+    }
+}
+
+void HttpExec::DeliverStreamData(RequestContext *context, const std::shared_ptr<HttpStreamBuffer> &stream)
+{
+    size_t size = stream->Size();
+    if (size > 0) {
+        void *buffer = nullptr;
+        napi_value arrayBuffer = NapiUtils::CreateArrayBuffer(context->GetEnv(), size, &buffer);
+        if (buffer != nullptr && arrayBuffer != nullptr && stream->Read(buffer, size) == size &&
+            !context->GetSharedManager()->IsEventDestroy()) {
+            context->EmitSharedManager(
+                ON_DATA_RECEIVE, std::make_pair(NapiUtils::GetUndefined(context->GetEnv()), arrayBuffer));
+        }
+    }
+    stream->OnDelivered(std::chrono::steady_clock::now());
+
+    if (!stream->IsPaused()) {
+        return;
+    }
+    stream->SetPaused(false);
+    {
+        std::lock_guard guard(staticVariable_.streamMutex);
+        auto it = staticVariable_.streamMap.find(context);
+        if (it != staticVariable_.streamMap.end()) {
+            staticVariable_.resumeList.push_back(it->second.first);
         }
+    }
+    if (staticVariable_.curlMulti != nullptr) {
+        (void)curl_multi_wakeup(staticVariable_.curlMulti);
+    }
+}
+
+void HttpExec::OnStreamDataReceive(napi_env env, napi_status status, void *data)
+{
+    // Looked up by address first, a delivery can run after OnStreamEnd has released the context.
+    auto context = static_cast<RequestContext *>(data);
+    auto stream = FindStream(context);
+    if (stream == nullptr) {
+        return;
+    }
+    DeliverStreamData(context, stream);
+}
 
-        auto ret = curl_multi_perform(staticVariable_.curlMulti, &runningHandle);
+void HttpExec::OnStreamEnd(napi_env env, napi_status status, void *data)
+{
+    auto context = static_cast<RequestContext *>(data);
+    auto stream = FindStream(context);
+    if (stream != nullptr) {
+        DeliverStreamData(context, stream);
+        UnregisterStream(context);
+    }
+    AsyncWorkRequestInStreamCallback(env, status, data);
+}
 
-        if (runningHandle > 0) {
-            ret = curl_multi_poll(staticVariable_.curlMulti, nullptr, 0, CURL_MAX_WAIT_MSECS, nullptr);
+void HttpExec::ResumeStreams()
+{
+    std::vector<CURL *> resumeList;
+    {
+        std::lock_guard guard(staticVariable_.streamMutex);
+        resumeList.swap(staticVariable_.resumeList);
+    }
+    if (resumeList.empty()) {
+        return;
+    }
+    // curl_easy_pause may call the write callback right away, so no stream lock is held here.
+    std::lock_guard guard(staticVariable_.curlMultiMutex);
+    for (auto handle : resumeList) {
+        if (staticVariable_.contextMap.find(handle) != staticVariable_.contextMap.end()) {
+            (void)curl_easy_pause(handle, CURLPAUSE_CONT);
         }
+    }
+}
 
-        if (ret != CURLM_OK) {
+void HttpExec::FlushIdleStreams()
+{
+    auto now = std::chrono::steady_clock::now();
+    std::lock_guard guard(staticVariable_.streamMutex);
+    for (const auto &p : staticVariable_.streamMap) {
+        if (p.second.second->ShouldFlush(now)) {
+            ScheduleStreamDelivery(p.first, p.second.second);
+        }
+    }
+}
+
+void HttpExec::SetMappedBodyThreshold(size_t threshold)
+{
+    std::lock_guard guard(staticVariable_.bodyMutex);
+    staticVariable_.mappedBodyThreshold = threshold;
+}
+
+size_t HttpExec::GetMappedBodyThreshold()
+{
+    std::lock_guard guard(staticVariable_.bodyMutex);
+    return staticVariable_.mappedBodyThreshold;
+}
+
+void HttpExec::ReleaseMappedBody(RequestContext *context)
+{
+    std::unique_ptr<HttpMappedBody> body;
+    {
+        std::lock_guard guard(staticVariable_.bodyMutex);
+        auto it = staticVariable_.mappedBodies.find(context);
+        if (it == staticVariable_.mappedBodies.end()) {
             return;
         }
+        body = std::move(it->second);
+        staticVariable_.mappedBodies.erase(it);
+    }
+}
 
-        ++num;
-        if (num >= CURL_HANDLE_NUM) {
-            break;
+bool HttpExec::IsArrayBufferResult(RequestContext *context)
+{
+    auto dataType = context->options.GetHttpDataType();
+    if (dataType == HttpDataType::ARRAY_BUFFER) {
+        return true;
+    }
+    if (dataType != HttpDataType::NO_DATA_TYPE) {
+        return false;
+    }
+    auto &header = const_cast<std::map<std::string, std::string> &>(context->response.GetHeader());
+    auto contentType = CommonUtils::ToLower(header[HttpConstant::HTTP_CONTENT_TYPE]);
+    return contentType.find(HttpConstant::HTTP_CONTENT_TYPE_OCTET_STREAM) != std::string::npos ||
+           contentType.find(HttpConstant::HTTP_CONTENT_TYPE_IMAGE) != std::string::npos;
+}
+
+void HttpExec::PrepareResponseBody(RequestContext *context)
+{
+    // Every header block of a redirect chain ends here, only the last one describes the body.
+    ReleaseMappedBody(context);
+    const auto &header = context->response.GetHeader();
+    auto lengthIt = header.find(HTTP_CONTENT_LENGTH);
+    if (lengthIt == header.end()) {
+        return;
+    }
+    char *end = nullptr;
+    auto length = std::strtoull(lengthIt->second.c_str(), &end, DECIMAL_BASE);
+    if (end == lengthIt->second.c_str() || length == 0 || length > context->options.GetMaxLimit()) {
+        return;
+    }
+
+    auto encodingIt = header.find(HTTP_CONTENT_ENCODING);
+    bool identity = encodingIt == header.end() || encodingIt->second.empty() ||
+                    CommonUtils::ToLower(encodingIt->second) == HTTP_CONTENT_ENCODING_IDENTITY;
+    size_t threshold = 0;
+    {
+        std::lock_guard guard(staticVariable_.bodyMutex);
+        threshold = staticVariable_.mappedBodyThreshold;
+    }
+    if (identity && threshold > 0 && length >= threshold && IsArrayBufferResult(context)) {
+        auto body = HttpMappedBody::Create(static_cast<size_t>(length));
+        if (body != nullptr) {
+            std::lock_guard guard(staticVariable_.bodyMutex);
+            staticVariable_.mappedBodies[context] = std::move(body);
+            return;
+        }
+    }
+    // A compressed body decodes to more than Content-Length, so this is only a lower bound.
+    const_cast<std::string &>(context->response.GetResult()).reserve(static_cast<size_t>(length));
+}
+
+bool HttpExec::WriteMappedBody(RequestContext *context, const void *data, size_t size)
+{
+    std::lock_guard guard(staticVariable_.bodyMutex);
+    auto it = staticVariable_.mappedBodies.find(context);
+    if (it == staticVariable_.mappedBodies.end()) {
+        return false;
+    }
+    if (it->second->Append(data, size)) {
+        return true;
+    }
+    // The server sent more than it announced, continue in the response string.
+    NETSTACK_LOGI("response body exceeds Content-Length, stop mapping it");
+    context->response.AppendResult(it->second->Data(), it->second->Size());
+    staticVariable_.mappedBodies.erase(it);
+    return false;
+}
+
+bool HttpExec::HasMappedBody(RequestContext *context)
+{
+    std::lock_guard guard(staticVariable_.bodyMutex);
+    return staticVariable_.mappedBodies.find(context) != staticVariable_.mappedBodies.end();
+}
+
+napi_value HttpExec::TakeMappedBody(RequestContext *context)
+{
+    std::unique_ptr<HttpMappedBody> body;
+    {
+        std::lock_guard guard(staticVariable_.bodyMutex);
+        auto it = staticVariable_.mappedBodies.find(context);
+        if (it == staticVariable_.mappedBodies.end()) {
+            return nullptr;
         }
-    } while (runningHandle > 0);
+        body = std::move(it->second);
+        staticVariable_.mappedBodies.erase(it);
+    }
+    // The ArrayBuffer adopts the mapping, it is unmapped when JS collects the buffer.
+    napi_value arrayBuffer = nullptr;
+    auto finalizer = [](napi_env env, void *data, void *hint) { delete static_cast<HttpMappedBody *>(hint); };
+    if (napi_create_external_arraybuffer(context->GetEnv(), body->Data(), body->Size(), finalizer, body.get(),
+        &arrayBuffer) != napi_ok) {
+        context->response.AppendResult(body->Data(), body->Size());
+        return nullptr;
+    }
+    (void)body.release();
+    return arrayBuffer;
 }
 
 void HttpExec::ReadResponse()
@@ -605,7 +895,7 @@ void HttpExec::ReadResponse()
             }
             if (msg->easy_handle) {
                 (void)curl_multi_remove_handle(staticVariable_.curlMulti, msg->easy_handle);
-                (void)curl_easy_cleanup(msg->easy_handle);
+                ReleaseCurlHandle(msg->easy_handle);
             }
         }
     } while (msg);
@@ -676,7 +966,21 @@ bool HttpExec::Initialize()
         NETSTACK_LOGE("Failed to initialize 'curl_multi'");
         return false;
     }
+    SetMultiOption(GetConnectionPolicy());
 
+    // DNS entries, TLS sessions and connections are shared so repeated calls to a host skip the handshake.
+    staticVariable_.curlShare = curl_share_init();
+    if (staticVariable_.curlShare != nullptr) {
+        (void)curl_share_setopt(staticVariable_.curlShare, CURLSHOPT_LOCKFUNC, LockShareData);
+        (void)curl_share_setopt(staticVariable_.curlShare, CURLSHOPT_UNLOCKFUNC, UnlockShareData);
+        (void)curl_share_setopt(staticVariable_.curlShare, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+        (void)curl_share_setopt(staticVariable_.curlShare, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+        (void)curl_share_setopt(staticVariable_.curlShare, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+    } else {
+        NETSTACK_LOGE("Failed to initialize 'curl_share', requests will not share connections");
+    }
+
+    staticVariable_.runThread = true;
     staticVariable_.workThread = std::thread(RunThread);
 
     staticVariable_.initialized = true;
@@ -727,6 +1031,144 @@ bool HttpExec::SetOtherOption(CURL *curl, OHOS::NetStack::Http::RequestContext *
     return true;
 }
 
+bool HttpExec::SetConnectionOption(CURL *curl, RequestContext *context)
+{
+    if (staticVariable_.curlShare != nullptr) {
+        NETSTACK_CURL_EASY_SET_OPTION(curl, CURLOPT_SHARE, staticVariable_.curlShare, context);
+    }
+    auto policy = GetConnectionPolicy();
+    if (!policy.keepAlive) {
+        NETSTACK_CURL_EASY_SET_OPTION(curl, CURLOPT_FORBID_REUSE, 1L, context);
+        return true;
+    }
+    NETSTACK_CURL_EASY_SET_OPTION(curl, CURLOPT_TCP_KEEPALIVE, 1L, context);
+    NETSTACK_CURL_EASY_SET_OPTION(curl, CURLOPT_TCP_KEEPIDLE, policy.keepAliveIdleSeconds, context);
+    NETSTACK_CURL_EASY_SET_OPTION(curl, CURLOPT_MAXAGE_CONN, policy.keepAliveIdleSeconds, context);
+    if (policy.multiplex) {
+        // Wait for a pending HTTP/2 connection to the same host rather than racing it with a new one.
+        NETSTACK_CURL_EASY_SET_OPTION(curl, CURLOPT_PIPEWAIT, 1L, context);
+    }
+    return true;
+}
+
+void HttpExec::SetMultiOption(const ConnectionPolicy &policy)
+{
+    if (staticVariable_.curlMulti == nullptr) {
+        return;
+    }
+    long pipelining = policy.multiplex ? CURLPIPE_MULTIPLEX : CURLPIPE_NOTHING;
+    if (curl_multi_setopt(staticVariable_.curlMulti, CURLMOPT_PIPELINING, pipelining) != CURLM_OK) {
+        NETSTACK_LOGE("set CURLMOPT_PIPELINING failed");
+    }
+    if (curl_multi_setopt(staticVariable_.curlMulti, CURLMOPT_MAX_HOST_CONNECTIONS, policy.maxHostConnections) !=
+        CURLM_OK) {
+        NETSTACK_LOGE("set CURLMOPT_MAX_HOST_CONNECTIONS failed");
+    }
+}
+
+void HttpExec::SetConnectionPolicy(const ConnectionPolicy &policy)
+{
+    std::vector<CURL *> trimmed;
+    {
+        std::lock_guard guard(staticVariable_.handlePoolMutex);
+        staticVariable_.connectionPolicy = policy;
+        while (staticVariable_.handlePool.size() > policy.handlePoolSize) {
+            trimmed.push_back(staticVariable_.handlePool.back());
+            staticVariable_.handlePool.pop_back();
+        }
+    }
+    for (auto handle : trimmed) {
+        curl_easy_cleanup(handle);
+    }
+    {
+        // curl_multi_setopt must not race the worker's curl_multi_poll, so the worker applies it.
+        std::lock_guard guard(staticVariable_.curlMultiMutex);
+        staticVariable_.multiOptionPending = true;
+    }
+    // Wakes the worker to apply the options, and a larger request budget may let queued requests start now.
+    if (staticVariable_.curlMulti != nullptr) {
+        (void)curl_multi_wakeup(staticVariable_.curlMulti);
+    }
+}
+
+void HttpExec::ApplyPendingMultiOption()
+{
+    auto policy = GetConnectionPolicy();
+    std::lock_guard guard(staticVariable_.curlMultiMutex);
+    if (!staticVariable_.multiOptionPending) {
+        return;
+    }
+    staticVariable_.multiOptionPending = false;
+    SetMultiOption(policy);
+}
+
+HttpExec::ConnectionPolicy HttpExec::GetConnectionPolicy()
+{
+    std::lock_guard guard(staticVariable_.handlePoolMutex);
+    return staticVariable_.connectionPolicy;
+}
+
+CURL *HttpExec::AcquireCurlHandle()
+{
+    {
+        std::lock_guard guard(staticVariable_.handlePoolMutex);
+        if (!staticVariable_.handlePool.empty()) {
+            CURL *handle = staticVariable_.handlePool.back();
+            staticVariable_.handlePool.pop_back();
+            return handle;
+        }
+    }
+    return curl_easy_init();
+}
+
+void HttpExec::ReleaseCurlHandle(CURL *handle)
+{
+    if (handle == nullptr) {
+        return;
+    }
+    // Only the options are cleared, connections and TLS sessions stay in the share for the next request.
+    curl_easy_reset(handle);
+    {
+        std::lock_guard guard(staticVariable_.handlePoolMutex);
+        if (staticVariable_.handlePool.size() < staticVariable_.connectionPolicy.handlePoolSize) {
+            staticVariable_.handlePool.push_back(handle);
+            return;
+        }
+    }
+    curl_easy_cleanup(handle);
+}
+
+void HttpExec::ClearCurlHandlePool()
+{
+    std::vector<CURL *> pool;
+    {
+        std::lock_guard guard(staticVariable_.handlePoolMutex);
+        pool.swap(staticVariable_.handlePool);
+    }
+    for (auto handle : pool) {
+        curl_easy_cleanup(handle);
+    }
+}
+
+void HttpExec::LockShareData(CURL *handle, curl_lock_data data, curl_lock_access access, void *userPtr)
+{
+    (void)handle;
+    (void)access;
+    (void)userPtr;
+    if (data >= 0 && data < CURL_LOCK_DATA_LAST) {
+        staticVariable_.shareMutex[data].lock();
+    }
+}
+
+void HttpExec::UnlockShareData(CURL *handle, curl_lock_data data, void *userPtr)
+{
+    (void)handle;
+    (void)userPtr;
+    if (data >= 0 && data < CURL_LOCK_DATA_LAST) {
+        staticVariable_.shareMutex[data].unlock();
+    }
+}
+
 bool HttpExec::SetServerSSLCertOption(CURL *curl, OHOS::NetStack::Http::RequestContext *context)
 {
     NETSTACK_CURL_EASY_SET_OPTION(curl, CURLOPT_SSL_VERIFYHOST, 0L, context);
@@ -820,7 +1262,7 @@ bool HttpExec::SetOption(CURL *curl, RequestContext *context, struct curl_slist
     if (!SetOtherOption(curl, context)) {
         return false;
     }
-    return true;
+    return SetConnectionOption(curl, context);
 }
 
 size_t HttpExec::OnWritingMemoryBody(const void *data, size_t size, size_t memBytes, void *userData)
@@ -834,8 +1276,22 @@ size_t HttpExec::OnWritingMemoryBody(const void *data, size_t size, size_t memBy
         return 0;
     }
     if (context->IsRequestInStream()) {
-        context->SetTempData(data, size * memBytes);
-        NapiUtils::CreateUvQueueWorkEnhanced(context->GetEnv(), context, OnDataReceive);
+        auto stream = FindStream(context);
+        if (stream == nullptr) {
+            context->SetTempData(data, size * memBytes);
+            NapiUtils::CreateUvQueueWorkEnhanced(context->GetEnv(), context, OnDataReceive);
+        } else if (!stream->Write(data, size * memBytes)) {
+            // JS has not drained the buffered chunks yet, hold the transfer until DeliverStreamData resumes it.
+            stream->SetPaused(true);
+            ScheduleStreamDelivery(context, stream);
+            return CURL_WRITEFUNC_PAUSE;
+        } else if (stream->ShouldFlush(std::chrono::steady_clock::now())) {
+            ScheduleStreamDelivery(context, stream);
+        }
+        context->StopAndCacheNapiPerformanceTiming(HttpConstant::RESPONSE_BODY_TIMING);
+        return size * memBytes;
+    }
+    if (WriteMappedBody(context, data, size * memBytes)) {
         context->StopAndCacheNapiPerformanceTiming(HttpConstant::RESPONSE_BODY_TIMING);
         return size * memBytes;
     }
@@ -935,6 +1391,9 @@ size_t HttpExec::OnWritingMemoryHeader(const void *data, size_t size, size_t mem
     context->response.AppendRawHeader(data, size * memBytes);
     if (CommonUtils::EndsWith(context->response.GetRawHeader(), HttpConstant::HTTP_RESPONSE_HEADER_SEPARATOR)) {
         context->response.ParseHeaders();
+        if (!context->IsRequestInStream()) {
+            PrepareResponseBody(context);
+        }
         if (context->GetSharedManager()) {
             auto headerMap = new std::map<std::string, std::string>(MakeHeaderWithSetCookie(context));
             context->GetSharedManager()->EmitByUvWithoutCheckShared(
@@ -1124,8 +1583,15 @@ bool HttpExec::ProcByExpectDataType(napi_value object, RequestContext *context)
             return false;
         }
         case HttpDataType::ARRAY_BUFFER: {
+            napi_value mappedBody = TakeMappedBody(context);
+            if (mappedBody != nullptr) {
+                NapiUtils::SetNamedProperty(context->GetEnv(), object, HttpConstant::RESPONSE_KEY_RESULT, mappedBody);
+                NapiUtils::SetUint32Property(context->GetEnv(), object, HttpConstant::RESPONSE_KEY_RESULT_TYPE,
+                                             static_cast<uint32_t>(HttpDataType::ARRAY_BUFFER));
+                return true;
+            }
             void *data = nullptr;
-            auto body = context->response.GetResult();
+            const auto &body = context->response.GetResult();
             napi_value arrayBuffer = NapiUtils::CreateArrayBuffer(context->GetEnv(), body.size(), &data);
             if (data != nullptr && arrayBuffer != nullptr) {
                 if (memcpy_s(data, body.size(), body.c_str(), body.size()) < 0) {
@@ -1158,14 +1624,27 @@ bool HttpExec::IsInitialized()
 
 void HttpExec::DeInitialize()
 {
-    std::lock_guard<std::mutex> lock(staticVariable_.curlMultiMutex);
-    staticVariable_.runThread = false;
-    staticVariable_.conditionVariable.notify_all();
+    {
+        std::lock_guard<std::mutex> lock(staticVariable_.curlMultiMutex);
+        staticVariable_.runThread = false;
+        staticVariable_.conditionVariable.notify_all();
+        if (staticVariable_.curlMulti) {
+            (void)curl_multi_wakeup(staticVariable_.curlMulti);
+        }
+    }
+    // The worker takes curlMultiMutex on every iteration, so it is joined without holding it.
     if (staticVariable_.workThread.joinable()) {
         staticVariable_.workThread.join();
     }
+    std::lock_guard<std::mutex> lock(staticVariable_.curlMultiMutex);
     if (staticVariable_.curlMulti) {
         curl_multi_cleanup(staticVariable_.curlMulti);
+        staticVariable_.curlMulti = nullptr;
+    }
+    ClearCurlHandlePool();
+    if (staticVariable_.curlShare) {
+        curl_share_cleanup(staticVariable_.curlShare);
+        staticVariable_.curlShare = nullptr;
     }
     staticVariable_.initialized = false;
 }
@@ -19,6 +19,8 @@
 #include <atomic>
 #include <condition_variable>
 #include <functional>
+#include <map>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <thread>
@@ -27,6 +29,8 @@
 #include <set>
 
 #include "curl/curl.h"
+#include "http_mapped_body.h"
+#include "http_stream_buffer.h"
 #include "napi/native_api.h"
 #include "request_context.h"
 
@@ -48,6 +52,21 @@ public:
 
 class HttpExec final {
 public:
+    // How finished easy handles and their connections are kept for later requests.
+    struct ConnectionPolicy {
+        size_t handlePoolSize = 8;
+        bool keepAlive = true;
+        long keepAliveIdleSeconds = 60;
+        // HTTP/2 requests to one host share a connection instead of opening one each.
+        bool multiplex = true;
+        long maxHostConnections = 6;
+        // Requests running at once, 0 means no limit. Later requests wait in the queue by priority.
+        size_t maxActiveRequests = 0;
+        // Slots only requests with at least highPriority may take, so bulk work cannot starve them.
+        size_t reservedHighPrioritySlots = 4;
+        uint32_t highPriority = 500;
+    };
+
     HttpExec() = default;
 
     ~HttpExec() = default;
@@ -76,6 +95,17 @@ public:
 
     static void DeInitialize();
 
+    static void SetConnectionPolicy(const ConnectionPolicy &policy);
+
+    static ConnectionPolicy GetConnectionPolicy();
+
+    // ArrayBuffer bodies announced at least this large are received into a mapping, 0 disables it.
+    static void SetMappedBodyThreshold(size_t threshold);
+
+    static size_t GetMappedBodyThreshold();
+
+    static void ReleaseMappedBody(RequestContext *context);
+
 #ifndef MAC_PLATFORM
     static void AsyncRunRequest(RequestContext *context);
 #endif
@@ -97,6 +127,18 @@ private:
 
     static bool SetServerSSLCertOption(CURL *curl, OHOS::NetStack::Http::RequestContext *context);
 
+    static bool SetConnectionOption(CURL *curl, RequestContext *context);
+
+    static CURL *AcquireCurlHandle();
+
+    static void ReleaseCurlHandle(CURL *handle);
+
+    static void ClearCurlHandlePool();
+
+    static void LockShareData(CURL *handle, curl_lock_data data, curl_lock_access access, void *userPtr);
+
+    static void UnlockShareData(CURL *handle, curl_lock_data data, void *userPtr);
+
     static bool SetRequestOption(void *curl, RequestContext *context);
 
     static size_t OnWritingMemoryBody(const void *data, size_t size, size_t memBytes, void *userData);
@@ -127,6 +169,36 @@ private:
 
     static void ReadResponse();
 
+    static void WaitForEvents();
+
+    static void RegisterStream(RequestContext *context, CURL *handle);
+
+    static void UnregisterStream(RequestContext *context);
+
+    static std::shared_ptr<HttpStreamBuffer> FindStream(RequestContext *context);
+
+    static void ScheduleStreamDelivery(RequestContext *context, const std::shared_ptr<HttpStreamBuffer> &stream);
+
+    static void DeliverStreamData(RequestContext *context, const std::shared_ptr<HttpStreamBuffer> &stream);
+
+    static void OnStreamDataReceive(napi_env env, napi_status status, void *data);
+
+    static void OnStreamEnd(napi_env env, napi_status status, void *data);
+
+    static void ResumeStreams();
+
+    static void FlushIdleStreams();
+
+    static void PrepareResponseBody(RequestContext *context);
+
+    static bool IsArrayBufferResult(RequestContext *context);
+
+    static bool WriteMappedBody(RequestContext *context, const void *data, size_t size);
+
+    static bool HasMappedBody(RequestContext *context);
+
+    static napi_value TakeMappedBody(RequestContext *context);
+
     static void GetGlobalHttpProxyInfo(std::string &host, int32_t &port, std::string &exclusions);
 
     static void GetHttpProxyInfo(RequestContext *context, std::string &host, int32_t &port, std::string &exclusions,
@@ -148,34 +220,46 @@ private:
 
     static void AddRequestInfo();
 
+    static bool CanAdmitRequest(const ConnectionPolicy &policy);
+
+    static void SetMultiOption(const ConnectionPolicy &policy);
+
+    static void ApplyPendingMultiOption();
+
     static bool IsContextDeleted(RequestContext *context);
 
     struct RequestInfo {
         RequestInfo() = delete;
         ~RequestInfo() = default;
 
-        RequestInfo(RequestContext *c, CURL *h)
+        RequestInfo(RequestContext *c, CURL *h, uint64_t s)
         {
             context = c;
             handle = h;
+            sequence = s;
         }
 
         RequestContext *context;
         CURL *handle;
+        uint64_t sequence;
 
+        // Requests of equal priority leave the queue in the order they were made.
         bool operator<(const RequestInfo &info) const
         {
-            return context->options.GetPriority() < info.context->options.GetPriority();
+            if (context->options.GetPriority() != info.context->options.GetPriority()) {
+                return context->options.GetPriority() < info.context->options.GetPriority();
+            }
+            return sequence > info.sequence;
         }
 
         bool operator>(const RequestInfo &info) const
         {
-            return context->options.GetPriority() > info.context->options.GetPriority();
+            return info < *this;
         }
     };
 
     struct StaticVariable {
-        StaticVariable() : curlMulti(nullptr), initialized(false), runThread(true) {}
+        StaticVariable() : curlMulti(nullptr), curlShare(nullptr), initialized(false), runThread(true) {}
 
         ~StaticVariable()
         {
@@ -187,10 +271,24 @@ private:
         std::mutex curlMultiMutex;
         std::mutex mutexForInitialize;
         CURLM *curlMulti;
+        CURLSH *curlShare;
+        std::mutex shareMutex[CURL_LOCK_DATA_LAST];
+        std::mutex handlePoolMutex;
+        std::vector<CURL *> handlePool;
+        ConnectionPolicy connectionPolicy;
+        // Set under curlMultiMutex, the worker applies the new policy to curlMulti between polls.
+        bool multiOptionPending = false;
+        std::mutex streamMutex;
+        std::map<RequestContext *, std::pair<CURL *, std::shared_ptr<HttpStreamBuffer>>> streamMap;
+        std::vector<CURL *> resumeList;
+        std::mutex bodyMutex;
+        size_t mappedBodyThreshold = 16 * 1024 * 1024;
+        std::map<RequestContext *, std::unique_ptr<HttpMappedBody>> mappedBodies;
         std::map<CURL *, RequestContext *> contextMap;
         std::thread workThread;
         std::condition_variable conditionVariable;
         std::priority_queue<RequestInfo> infoQueue;
+        uint64_t requestSequence = 0;
 
 #ifndef MAC_PLATFORM
         std::atomic_bool initialized;
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "http_mapped_body.h"
+
+#include <cerrno>
+#include <sys/mman.h>
+
+#include "netstack_log.h"
+#include "securec.h"
+
+namespace OHOS::NetStack::Http {
+std::unique_ptr<HttpMappedBody> HttpMappedBody::Create(size_t capacity)
+{
+    if (capacity == 0) {
+        return nullptr;
+    }
+    void *address = mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (address == MAP_FAILED) {
+        NETSTACK_LOGE("map response body failed %{public}d", errno);
+        return nullptr;
+    }
+    return std::unique_ptr<HttpMappedBody>(new HttpMappedBody(address, capacity));
+}
+
+HttpMappedBody::HttpMappedBody(void *address, size_t capacity) : address_(address), capacity_(capacity) {}
+
+HttpMappedBody::~HttpMappedBody()
+{
+    if (munmap(address_, capacity_) < 0) {
+        NETSTACK_LOGE("unmap response body failed %{public}d", errno);
+    }
+}
+
+bool HttpMappedBody::Append(const void *data, size_t size)
+{
+    if (size > capacity_ - size_) {
+        return false;
+    }
+    if (size > 0 && memcpy_s(Data() + size_, capacity_ - size_, data, size) != EOK) {
+        return false;
+    }
+    size_ += size;
+    return true;
+}
+
+uint8_t *HttpMappedBody::Data() const
+{
+    return static_cast<uint8_t *>(address_);
+}
+
+size_t HttpMappedBody::Size() const
+{
+    return size_;
+}
+} // namespace OHOS::NetStack::Http
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef COMMUNICATIONNETSTACK_HTTP_MAPPED_BODY_H
+#define COMMUNICATIONNETSTACK_HTTP_MAPPED_BODY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace OHOS::NetStack::Http {
+/*
+ * Fixed size anonymous mapping that receives a large response body. The pages are
+ * only committed as the body arrives, and the mapping can back a JS ArrayBuffer
+ * directly, so the body is neither reallocated while growing nor copied at the end.
+ */
+class HttpMappedBody final {
+public:
+    static std::unique_ptr<HttpMappedBody> Create(size_t capacity);
+
+    ~HttpMappedBody();
+
+    HttpMappedBody(const HttpMappedBody &) = delete;
+
+    HttpMappedBody &operator=(const HttpMappedBody &) = delete;
+
+    // Fails without writing anything if the body outgrows the announced length.
+    bool Append(const void *data, size_t size);
+
+    uint8_t *Data() const;
+
+    size_t Size() const;
+
+private:
+    HttpMappedBody(void *address, size_t capacity);
+
+    void *address_;
+    size_t capacity_;
+    size_t size_ = 0;
+};
+} // namespace OHOS::NetStack::Http
+#endif /* COMMUNICATIONNETSTACK_HTTP_MAPPED_BODY_H */
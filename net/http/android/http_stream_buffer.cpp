@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "http_stream_buffer.h"
+
+#include <algorithm>
+
+#include "securec.h"
+
+namespace OHOS::NetStack::Http {
+HttpStreamBuffer::HttpStreamBuffer(size_t capacity, size_t flushThreshold, std::chrono::milliseconds flushInterval)
+    : buffer_(capacity),
+      flushThreshold_(std::min(flushThreshold, capacity)),
+      flushInterval_(flushInterval),
+      lastDelivery_(std::chrono::steady_clock::now())
+{
+}
+
+bool HttpStreamBuffer::Write(const void *data, size_t size)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (size == 0) {
+        return true;
+    }
+    if (size > buffer_.size() - size_) {
+        if (size_ != 0) {
+            return false;
+        }
+        // A single chunk larger than the ring, only possible with a tiny capacity.
+        buffer_.resize(size);
+        head_ = 0;
+    }
+    auto bytes = static_cast<const uint8_t *>(data);
+    size_t tail = (head_ + size_) % buffer_.size();
+    size_t first = std::min(size, buffer_.size() - tail);
+    if (memcpy_s(buffer_.data() + tail, buffer_.size() - tail, bytes, first) != EOK) {
+        return false;
+    }
+    if (first < size && memcpy_s(buffer_.data(), buffer_.size(), bytes + first, size - first) != EOK) {
+        return false;
+    }
+    size_ += size;
+    return true;
+}
+
+size_t HttpStreamBuffer::Read(void *buffer, size_t size)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    size = std::min(size, size_);
+    if (size == 0) {
+        return 0;
+    }
+    auto bytes = static_cast<uint8_t *>(buffer);
+    size_t first = std::min(size, buffer_.size() - head_);
+    if (memcpy_s(bytes, size, buffer_.data() + head_, first) != EOK) {
+        return 0;
+    }
+    if (first < size && memcpy_s(bytes + first, size - first, buffer_.data(), size - first) != EOK) {
+        return 0;
+    }
+    head_ = (head_ + size) % buffer_.size();
+    size_ -= size;
+    return size;
+}
+
+size_t HttpStreamBuffer::Size()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return size_;
+}
+
+bool HttpStreamBuffer::ShouldFlush(std::chrono::steady_clock::time_point now)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return size_ >= flushThreshold_ || (size_ > 0 && now - lastDelivery_ >= flushInterval_);
+}
+
+bool HttpStreamBuffer::TryScheduleDelivery()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (deliveryScheduled_) {
+        return false;
+    }
+    deliveryScheduled_ = true;
+    return true;
+}
+
+void HttpStreamBuffer::OnDelivered(std::chrono::steady_clock::time_point now)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    deliveryScheduled_ = false;
+    lastDelivery_ = now;
+}
+
+void HttpStreamBuffer::SetPaused(bool paused)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    paused_ = paused;
+}
+
+bool HttpStreamBuffer::IsPaused()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return paused_;
+}
+} // namespace OHOS::NetStack::Http
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef COMMUNICATIONNETSTACK_HTTP_STREAM_BUFFER_H
+#define COMMUNICATIONNETSTACK_HTTP_STREAM_BUFFER_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace OHOS::NetStack::Http {
+/*
+ * Preallocated ring buffer between the curl write callback and the JS thread of a
+ * requestInStream call. Chunks are coalesced here and handed to JS in one piece once
+ * enough bytes, or old enough bytes, are buffered. A full buffer rejects the write so
+ * the caller can pause the transfer until JS has drained it.
+ */
+class HttpStreamBuffer final {
+public:
+    HttpStreamBuffer(size_t capacity, size_t flushThreshold, std::chrono::milliseconds flushInterval);
+
+    // Takes the whole chunk or nothing, a rejected chunk is delivered again by curl after resuming.
+    bool Write(const void *data, size_t size);
+
+    size_t Read(void *buffer, size_t size);
+
+    size_t Size();
+
+    bool ShouldFlush(std::chrono::steady_clock::time_point now);
+
+    // Returns true if the caller has to queue a delivery, at most one is queued at a time.
+    bool TryScheduleDelivery();
+
+    void OnDelivered(std::chrono::steady_clock::time_point now);
+
+    void SetPaused(bool paused);
+
+    bool IsPaused();
+
+private:
+    std::mutex mutex_;
+    std::vector<uint8_t> buffer_;
+    size_t head_ = 0;
+    size_t size_ = 0;
+    size_t flushThreshold_;
+    std::chrono::milliseconds flushInterval_;
+    std::chrono::steady_clock::time_point lastDelivery_;
+    bool deliveryScheduled_ = false;
+    bool paused_ = false;
+};
+} // namespace OHOS::NetStack::Http
+#endif /* COMMUNICATIONNETSTACK_HTTP_STREAM_BUFFER_H */
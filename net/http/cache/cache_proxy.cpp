@@ -28,13 +28,15 @@
 #include "netstack_log.h"
 #include "request_context.h"
 
-static constexpr int32_t WRITE_INTERVAL = 60;
+// Longest time an entry waits in memory, a crash loses at most this batch.
+static constexpr int32_t WRITE_INTERVAL = 5;
 
 namespace OHOS::NetStack::Http {
 std::mutex g_diskCacheMutex;
 std::mutex g_cacheNeedRunMutex;
 std::atomic_bool g_cacheNeedRun(false);
 std::atomic_bool g_cacheIsRunning(false);
+std::atomic_bool g_cacheBatchReady(false);
 std::condition_variable g_cacheThreadCondition;
 std::condition_variable g_cacheNeedRunCondition;
 static std::shared_ptr<LRUCacheDiskHandler> DISK_LRU_CACHE = nullptr;
@@ -65,17 +67,18 @@ bool CacheProxy::ReadResponseFromCache(RequestContext* context)
         DISK_LRU_CACHE = std::make_shared<LRUCacheDiskHandler>(HttpExec::GetCacheFileName(), 0);
     }
 
-    auto responseFromCache = DISK_LRU_CACHE->Get(key_);
+    std::string body;
+    auto responseFromCache = DISK_LRU_CACHE->Get(key_, body);
     if (responseFromCache.empty()) {
         NETSTACK_LOGI("no cache with this request");
         return false;
     }
     HttpResponse cachedResponse;
-    cachedResponse.SetRawHeader(OHOS::NetStack::Base64::Decode(responseFromCache[HttpConstant::RESPONSE_KEY_HEADER]));
-    cachedResponse.SetResult(OHOS::NetStack::Base64::Decode(responseFromCache[HttpConstant::RESPONSE_KEY_RESULT]));
-    cachedResponse.SetCookies(OHOS::NetStack::Base64::Decode(responseFromCache[HttpConstant::RESPONSE_KEY_COOKIES]));
-    cachedResponse.SetResponseTime(OHOS::NetStack::Base64::Decode(responseFromCache[HttpConstant::RESPONSE_TIME]));
-    cachedResponse.SetRequestTime(OHOS::NetStack::Base64::Decode(responseFromCache[HttpConstant::REQUEST_TIME]));
+    cachedResponse.SetRawHeader(responseFromCache[HttpConstant::RESPONSE_KEY_HEADER]);
+    cachedResponse.SetResult(body);
+    cachedResponse.SetCookies(responseFromCache[HttpConstant::RESPONSE_KEY_COOKIES]);
+    cachedResponse.SetResponseTime(responseFromCache[HttpConstant::RESPONSE_TIME]);
+    cachedResponse.SetRequestTime(responseFromCache[HttpConstant::REQUEST_TIME]);
     cachedResponse.SetResponseCode(static_cast<uint32_t>(ResponseCode::OK));
     cachedResponse.ParseHeaders();
 
@@ -103,17 +106,21 @@ void CacheProxy::WriteResponseToCache(const HttpResponse &response)
         NETSTACK_LOGE("do not cache this response");
         return;
     }
+    // Stored verbatim, the body goes to the entry file and only the small fields to the metadata.
     std::unordered_map<std::string, std::string> cacheResponse;
-    cacheResponse[HttpConstant::RESPONSE_KEY_HEADER] = OHOS::NetStack::Base64::Encode(response.GetRawHeader());
-    cacheResponse[HttpConstant::RESPONSE_KEY_RESULT] = OHOS::NetStack::Base64::Encode(response.GetResult());
-    cacheResponse[HttpConstant::RESPONSE_KEY_COOKIES] = OHOS::NetStack::Base64::Encode(response.GetCookies());
-    cacheResponse[HttpConstant::RESPONSE_TIME] = OHOS::NetStack::Base64::Encode(response.GetResponseTime());
-    cacheResponse[HttpConstant::REQUEST_TIME] = OHOS::NetStack::Base64::Encode(response.GetRequestTime());
+    cacheResponse[HttpConstant::RESPONSE_KEY_HEADER] = response.GetRawHeader();
+    cacheResponse[HttpConstant::RESPONSE_KEY_COOKIES] = response.GetCookies();
+    cacheResponse[HttpConstant::RESPONSE_TIME] = response.GetResponseTime();
+    cacheResponse[HttpConstant::REQUEST_TIME] = response.GetRequestTime();
 
     if (DISK_LRU_CACHE == nullptr) {
         DISK_LRU_CACHE = std::make_shared<LRUCacheDiskHandler>(HttpExec::GetCacheFileName(), 0);
     }
-    DISK_LRU_CACHE->Put(key_, cacheResponse);
+    if (DISK_LRU_CACHE->Put(key_, cacheResponse, response.GetResult())) {
+        std::lock_guard<std::mutex> lock(g_cacheNeedRunMutex);
+        g_cacheBatchReady.store(true);
+        g_cacheNeedRunCondition.notify_all();
+    }
 }
 
 void CacheProxy::RunCache()
@@ -133,19 +140,22 @@ void CacheProxy::RunCacheWithSize(size_t capacity)
 
     g_cacheNeedRun.store(true);
 
-    DISK_LRU_CACHE->ReadCacheFromJsonFile();
+    DISK_LRU_CACHE->ReadCacheFromDisk();
 
     std::thread([]() {
         g_cacheIsRunning.store(true);
         while (g_cacheNeedRun.load()) {
-            std::unique_lock<std::mutex> lock(g_cacheNeedRunMutex);
-            g_cacheNeedRunCondition.wait_for(
-                lock, std::chrono::seconds(WRITE_INTERVAL), [] { return !g_cacheNeedRun.load(); });
+            {
+                std::unique_lock<std::mutex> lock(g_cacheNeedRunMutex);
+                g_cacheNeedRunCondition.wait_for(lock, std::chrono::seconds(WRITE_INTERVAL),
+                    [] { return !g_cacheNeedRun.load() || g_cacheBatchReady.load(); });
+                g_cacheBatchReady.store(false);
+            }
 
             if (DISK_LRU_CACHE == nullptr) {
                 DISK_LRU_CACHE = std::make_shared<LRUCacheDiskHandler>(HttpExec::GetCacheFileName(), 0);
             }
-            DISK_LRU_CACHE->WriteCacheToJsonFile();
+            DISK_LRU_CACHE->WriteCacheToDisk();
         }
 
         g_cacheIsRunning.store(false);
@@ -161,7 +171,7 @@ void CacheProxy::FlushCache()
     if (DISK_LRU_CACHE == nullptr) {
         DISK_LRU_CACHE = std::make_shared<LRUCacheDiskHandler>(HttpExec::GetCacheFileName(), 0);
     }
-    DISK_LRU_CACHE->WriteCacheToJsonFile();
+    DISK_LRU_CACHE->WriteCacheToDisk();
 }
 
 void CacheProxy::StopCacheAndDelete()
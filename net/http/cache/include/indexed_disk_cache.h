@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef COMMUNICATIONNETSTACK_INDEXED_DISK_CACHE_H
+#define COMMUNICATIONNETSTACK_INDEXED_DISK_CACHE_H
+
+#include <cstdint>
+#include <fstream>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace OHOS::NetStack::Http {
+/*
+ * On-disk LRU store made of one file per entry plus an append-only journal.
+ * The journal records puts, reads and removals; it is replayed on first use
+ * and compacted once it holds mostly stale records. Lookups, inserts and
+ * evictions touch only the journal tail and the files of the affected entries.
+ * Files the replayed journal does not reference are removed on load.
+ * An entry file holds the length-prefixed metadata followed by the raw body.
+ * Journal records are buffered until Sync(), which makes a whole batch durable
+ * at once: the new entry files first, then the records that point to them.
+ */
+class IndexedDiskCache final {
+public:
+    // Metadata field added by Get() that tells ReadBody() where the body is stored.
+    static constexpr const char *BODY_REF_FIELD = "bodyRef";
+
+    IndexedDiskCache() = delete;
+
+    IndexedDiskCache(std::string directory, size_t capacity);
+
+    ~IndexedDiskCache();
+
+    void SetCapacity(size_t capacity);
+
+    std::unordered_map<std::string, std::string> Get(const std::string &key);
+
+    bool ReadBody(const std::unordered_map<std::string, std::string> &metadata, std::string &body) const;
+
+    void Put(const std::string &key, const std::unordered_map<std::string, std::string> &metadata,
+        const std::string &body);
+
+    void Remove(const std::string &key);
+
+    void Delete();
+
+    void Sync();
+
+private:
+    struct IndexEntry {
+        std::string fileName;
+        size_t size = 0;
+        std::list<std::string>::iterator lruIt;
+    };
+
+    void EnsureLoaded();
+
+    void LoadJournal();
+
+    void RemoveOrphanFiles();
+
+    void AppendJournal(const std::string &record);
+
+    void CompactJournalIfNeeded();
+
+    void CommitEntry(const std::string &key, const std::string &fileName, size_t size);
+
+    void EraseEntry(const std::string &key, bool removeFile);
+
+    void TrimToCapacity();
+
+    std::string GetPath(const std::string &fileName) const;
+
+    std::mutex syncMutex_;
+    std::mutex mutex_;
+    std::string directory_;
+    size_t capacity_;
+    size_t size_ = 0;
+    bool loaded_ = false;
+    uint64_t nextFileId_ = 0;
+    size_t journalRecords_ = 0;
+    std::ofstream journal_;
+    std::string journalBuffer_;
+    std::vector<std::string> unsyncedFiles_;
+    uint64_t generation_ = 0;
+    std::list<std::string> lruList_;
+    std::unordered_map<std::string, IndexEntry> index_;
+};
+} // namespace OHOS::NetStack::Http
+#endif /* COMMUNICATIONNETSTACK_INDEXED_DISK_CACHE_H */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -13,55 +13,61 @@
  * limitations under the License.
  */
 
-#ifndef COMMUNICATIONNETSTACK_LRU_CACHE_IOS_H
-#define COMMUNICATIONNETSTACK_LRU_CACHE_IOS_H
+#ifndef COMMUNICATIONNETSTACK_LRU_CACHE_H
+#define COMMUNICATIONNETSTACK_LRU_CACHE_H
 
+#include <atomic>
 #include <list>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <unordered_map>
-#include <vector>
 
 namespace OHOS::NetStack::Http {
+/*
+ * Size bounded memory LRU. Values are immutable and shared, so a hit only bumps
+ * a reference count and relinks the node; the value is never copied under the lock.
+ */
 class LRUCache {
 public:
+    using Entry = std::unordered_map<std::string, std::string>;
+    using EntryPtr = std::shared_ptr<const Entry>;
+
     LRUCache();
 
     explicit LRUCache(size_t capacity);
 
-    std::unordered_map<std::string, std::string> Get(const std::string &key);
+    EntryPtr Get(const std::string &key);
 
-    void Put(const std::string &key, const std::unordered_map<std::string, std::string> &value);
+    void Put(const std::string &key, EntryPtr value);
 
-    void MergeOtherCache(const LRUCache &other);
+    void Put(const std::string &key, Entry value);
 
-    std::string WriteCacheToJsonValue();
+    void Clear();
 
-    void ReadCacheFromJsonValue(const std::string root);
+    // Drops the least recently used entry, returns false if the cache is empty.
+    bool EraseTail();
 
-    void Clear();
+    size_t GetSize() const;
 
 private:
     struct Node {
         std::string key;
-        std::unordered_map<std::string, std::string> value;
+        EntryPtr value;
+        size_t size;
 
         Node() = delete;
 
-        Node(std::string key, std::unordered_map<std::string, std::string> value);
+        Node(std::string key, EntryPtr value, size_t size);
     };
 
-    void AddNode(const Node &node);
-
-    void MoveNodeToHead(const std::list<Node>::iterator &it);
-
     void EraseTailNode();
 
     std::mutex mutex_;
     std::unordered_map<std::string, std::list<Node>::iterator> cache_;
     std::list<Node> nodeList_;
     size_t capacity_;
-    size_t size_;
+    std::atomic<size_t> size_;
 };
 } // namespace OHOS::NetStack::Http
-#endif /* COMMUNICATIONNETSTACK_LRU_CACHE_IOS_H */
+#endif /* COMMUNICATIONNETSTACK_LRU_CACHE_H */
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef COMMUNICATIONNETSTACK_LRU_CACHE_DISK_HANDLER_H
+#define COMMUNICATIONNETSTACK_LRU_CACHE_DISK_HANDLER_H
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "indexed_disk_cache.h"
+#include "sharded_lru_cache.h"
+
+static constexpr const int MAX_DISK_CACHE_SIZE = 1024 * 1024 * 10;
+static constexpr const int MIN_DISK_CACHE_SIZE = 1024 * 1024;
+static constexpr const int WRITE_BEHIND_BATCH_SIZE = 1024 * 256;
+
+namespace OHOS::NetStack::Http {
+/*
+ * Memory LRU in front of an IndexedDiskCache. Puts are kept in memory until the
+ * next WriteCacheToDisk(), which writes only the entries added since the last one
+ * and syncs them as one batch. Repeated puts of a key before that coalesce.
+ * Bodies are stored verbatim on disk, the memory LRU only holds entry metadata.
+ */
+class LRUCacheDiskHandler {
+public:
+    LRUCacheDiskHandler() = delete;
+
+    LRUCacheDiskHandler(std::string fileName, size_t capacity);
+
+    void WriteCacheToDisk();
+
+    void ReadCacheFromDisk();
+
+    void Delete();
+
+    void SetCapacity(size_t capacity);
+
+    std::unordered_map<std::string, std::string> Get(const std::string &key, std::string &body);
+
+    // Returns true once enough is pending that the writer should flush a batch now.
+    bool Put(const std::string &key, const std::unordered_map<std::string, std::string> &metadata,
+        const std::string &body);
+
+private:
+    struct PendingEntry {
+        std::unordered_map<std::string, std::string> metadata;
+        std::string body;
+    };
+
+    using PendingMap = std::unordered_map<std::string, PendingEntry>;
+
+    static bool FindPending(const PendingMap &entries, const std::string &key,
+        std::unordered_map<std::string, std::string> &metadata, std::string &body);
+
+    std::string fileName_;
+    ShardedLRUCache cache_;
+    IndexedDiskCache diskCache_;
+    std::mutex flushMutex_;
+    std::mutex pendingMutex_;
+    PendingMap pending_;
+    PendingMap flushing_;
+    size_t pendingSize_ = 0;
+};
+} // namespace OHOS::NetStack::Http
+#endif /* COMMUNICATIONNETSTACK_LRU_CACHE_DISK_HANDLER_H */
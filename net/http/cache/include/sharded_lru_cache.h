@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef COMMUNICATIONNETSTACK_SHARDED_LRU_CACHE_H
+#define COMMUNICATIONNETSTACK_SHARDED_LRU_CACHE_H
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "lru_cache.h"
+
+namespace OHOS::NetStack::Http {
+/*
+ * LRUCache split into shards by key hash, so concurrent requests only contend
+ * when their keys land in the same shard. The byte budget is shared: a put that
+ * takes the total over it evicts from its own shard first, then from the others.
+ */
+class ShardedLRUCache final {
+public:
+    static constexpr const size_t DEFAULT_SHARD_COUNT = 16;
+
+    ShardedLRUCache();
+
+    explicit ShardedLRUCache(size_t capacity, size_t shardCount = DEFAULT_SHARD_COUNT);
+
+    LRUCache::EntryPtr Get(const std::string &key);
+
+    void Put(const std::string &key, LRUCache::EntryPtr value);
+
+    void Put(const std::string &key, LRUCache::Entry value);
+
+    void Clear();
+
+    size_t GetSize() const;
+
+private:
+    LRUCache &GetShard(size_t index);
+
+    size_t GetShardIndex(const std::string &key) const;
+
+    void EvictIfNeeded(size_t shardIndex);
+
+    size_t capacity_;
+    std::vector<std::unique_ptr<LRUCache>> shards_;
+    std::atomic<size_t> evictCursor_ { 0 };
+};
+} // namespace OHOS::NetStack::Http
+#endif /* COMMUNICATIONNETSTACK_SHARDED_LRU_CACHE_H */
@@ -0,0 +1,536 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "indexed_disk_cache.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sstream>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <unordered_set>
+
+#include "netstack_log.h"
+
+static constexpr const char *JOURNAL_FILE = "journal";
+static constexpr const char *JOURNAL_TMP_FILE = "journal.tmp";
+static constexpr const char *ENTRY_SUFFIX = ".entry";
+static constexpr const char *TMP_SUFFIX = ".tmp";
+static constexpr const char RECORD_PUT = 'P';
+static constexpr const char RECORD_READ = 'R';
+static constexpr const char RECORD_REMOVE = 'D';
+static constexpr const size_t MIN_COMPACT_RECORDS = 256;
+static constexpr const int HEX_BASE = 16;
+static constexpr const mode_t CACHE_DIR_MODE = 0700;
+
+namespace OHOS::NetStack::Http {
+static void AppendLength(std::string &buffer, uint32_t length)
+{
+    buffer.append(reinterpret_cast<const char *>(&length), sizeof(length));
+}
+
+static std::string SerializeEntry(const std::unordered_map<std::string, std::string> &value)
+{
+    size_t total = sizeof(uint32_t);
+    for (const auto &p : value) {
+        total += sizeof(uint32_t) * 2 + p.first.size() + p.second.size();
+    }
+    std::string buffer;
+    buffer.reserve(total);
+    AppendLength(buffer, static_cast<uint32_t>(value.size()));
+    for (const auto &p : value) {
+        AppendLength(buffer, static_cast<uint32_t>(p.first.size()));
+        buffer += p.first;
+        AppendLength(buffer, static_cast<uint32_t>(p.second.size()));
+        buffer += p.second;
+    }
+    return buffer;
+}
+
+static bool ReadLength(const std::string &buffer, size_t &offset, uint32_t &length)
+{
+    if (buffer.size() - offset < sizeof(length)) {
+        return false;
+    }
+    memcpy(&length, buffer.data() + offset, sizeof(length));
+    offset += sizeof(length);
+    return true;
+}
+
+static bool ReadField(const std::string &buffer, size_t &offset, std::string &field)
+{
+    uint32_t length = 0;
+    if (!ReadLength(buffer, offset, length) || buffer.size() - offset < length) {
+        return false;
+    }
+    field.assign(buffer, offset, length);
+    offset += length;
+    return true;
+}
+
+static bool DeserializeEntry(const std::string &buffer, std::unordered_map<std::string, std::string> &value)
+{
+    size_t offset = 0;
+    uint32_t count = 0;
+    if (!ReadLength(buffer, offset, count)) {
+        return false;
+    }
+    for (uint32_t i = 0; i < count; ++i) {
+        std::string key;
+        std::string field;
+        if (!ReadField(buffer, offset, key) || !ReadField(buffer, offset, field)) {
+            return false;
+        }
+        value[std::move(key)] = std::move(field);
+    }
+    return offset == buffer.size();
+}
+
+// Keys are URLs and may contain spaces, so a key always takes the rest of the record.
+static bool ReadKey(std::istringstream &record, std::string &key)
+{
+    return static_cast<bool>(std::getline(record >> std::ws, key)) && !key.empty();
+}
+
+static bool ReadMetadata(const std::string &path, std::unordered_map<std::string, std::string> &metadata,
+    size_t &bodyOffset)
+{
+    std::ifstream r(path, std::ios::binary | std::ios::ate);
+    if (!r.is_open()) {
+        return false;
+    }
+    std::streamsize fileSize = r.tellg();
+    uint32_t length = 0;
+    if (fileSize < static_cast<std::streamsize>(sizeof(length))) {
+        return false;
+    }
+    r.seekg(0, std::ios::beg);
+    if (!r.read(reinterpret_cast<char *>(&length), sizeof(length)) ||
+        static_cast<uint64_t>(fileSize) - sizeof(length) < length) {
+        return false;
+    }
+    std::string buffer(length, '\0');
+    if (!r.read(buffer.data(), length)) {
+        return false;
+    }
+    bodyOffset = sizeof(length) + length;
+    return DeserializeEntry(buffer, metadata);
+}
+
+static void SyncFile(const std::string &path)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return;
+    }
+    if (fsync(fd) < 0) {
+        NETSTACK_LOGE("sync cache file error %{public}d", errno);
+    }
+    close(fd);
+}
+
+static bool WriteEntryFile(const std::string &path, const std::string &metadata, const std::string &body)
+{
+    std::string tmpPath = path + TMP_SUFFIX;
+    {
+        auto length = static_cast<uint32_t>(metadata.size());
+        std::ofstream w(tmpPath, std::ios::binary | std::ios::trunc);
+        if (!w.is_open() || !w.write(reinterpret_cast<const char *>(&length), sizeof(length)) ||
+            !w.write(metadata.data(), static_cast<std::streamsize>(metadata.size())) ||
+            !w.write(body.data(), static_cast<std::streamsize>(body.size()))) {
+            NETSTACK_LOGE("write cache entry failed");
+            remove(tmpPath.c_str());
+            return false;
+        }
+    }
+    if (rename(tmpPath.c_str(), path.c_str()) < 0) {
+        NETSTACK_LOGE("rename cache entry failed %{public}d", errno);
+        remove(tmpPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+IndexedDiskCache::IndexedDiskCache(std::string directory, size_t capacity)
+    : directory_(std::move(directory)), capacity_(capacity)
+{
+}
+
+IndexedDiskCache::~IndexedDiskCache()
+{
+    std::lock_guard<std::mutex> syncGuard(syncMutex_);
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (!journal_.is_open()) {
+        return;
+    }
+    // Same order as Sync(): the buffered records may only land once their entry files are durable.
+    if (!journalBuffer_.empty()) {
+        for (const auto &fileName : unsyncedFiles_) {
+            SyncFile(GetPath(fileName));
+        }
+        journal_ << journalBuffer_;
+        journal_.flush();
+        SyncFile(GetPath(JOURNAL_FILE));
+        SyncFile(directory_);
+    }
+    journal_.close();
+}
+
+void IndexedDiskCache::SetCapacity(size_t capacity)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    capacity_ = capacity;
+    if (loaded_) {
+        TrimToCapacity();
+    }
+}
+
+std::unordered_map<std::string, std::string> IndexedDiskCache::Get(const std::string &key)
+{
+    std::string fileName;
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        EnsureLoaded();
+        auto it = index_.find(key);
+        if (it == index_.end()) {
+            return {};
+        }
+        fileName = it->second.fileName;
+        lruList_.splice(lruList_.begin(), lruList_, it->second.lruIt);
+        AppendJournal(std::string(1, RECORD_READ) + " " + key);
+    }
+
+    std::unordered_map<std::string, std::string> metadata;
+    size_t bodyOffset = 0;
+    if (ReadMetadata(GetPath(fileName), metadata, bodyOffset)) {
+        metadata[BODY_REF_FIELD] = fileName + " " + std::to_string(bodyOffset);
+        return metadata;
+    }
+
+    NETSTACK_LOGI("cache entry is missing or broken, drop it");
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto it = index_.find(key);
+    if (it != index_.end() && it->second.fileName == fileName) {
+        EraseEntry(key, true);
+    }
+    return {};
+}
+
+bool IndexedDiskCache::ReadBody(const std::unordered_map<std::string, std::string> &metadata, std::string &body) const
+{
+    auto ref = metadata.find(BODY_REF_FIELD);
+    if (ref == metadata.end()) {
+        return false;
+    }
+    std::istringstream refStream(ref->second);
+    std::string fileName;
+    size_t bodyOffset = 0;
+    if (!(refStream >> fileName >> bodyOffset)) {
+        return false;
+    }
+
+    // Entry files are never rewritten in place, a file that is still there holds the same entry.
+    std::ifstream r(GetPath(fileName), std::ios::binary | std::ios::ate);
+    if (!r.is_open()) {
+        return false;
+    }
+    std::streamsize fileSize = r.tellg();
+    if (fileSize < 0 || static_cast<uint64_t>(fileSize) < bodyOffset) {
+        return false;
+    }
+    body.resize(static_cast<size_t>(fileSize) - bodyOffset);
+    r.seekg(static_cast<std::streamoff>(bodyOffset), std::ios::beg);
+    return static_cast<bool>(r.read(body.data(), static_cast<std::streamsize>(body.size())));
+}
+
+void IndexedDiskCache::Put(const std::string &key, const std::unordered_map<std::string, std::string> &metadata,
+    const std::string &body)
+{
+    std::string fileName;
+    size_t capacity = 0;
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        EnsureLoaded();
+        std::stringstream name;
+        name << std::hex << nextFileId_++ << ENTRY_SUFFIX;
+        fileName = name.str();
+        capacity = capacity_;
+    }
+
+    // The entry file gets a fresh name, so it is written without holding the index lock.
+    std::string content = SerializeEntry(metadata);
+    size_t size = sizeof(uint32_t) + content.size() + body.size();
+    if (size > capacity || !WriteEntryFile(GetPath(fileName), content, body)) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    CommitEntry(key, fileName, size);
+}
+
+void IndexedDiskCache::Remove(const std::string &key)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    EnsureLoaded();
+    if (index_.find(key) != index_.end()) {
+        EraseEntry(key, true);
+    }
+}
+
+void IndexedDiskCache::Delete()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    EnsureLoaded();
+    for (const auto &p : index_) {
+        remove(GetPath(p.second.fileName).c_str());
+    }
+    index_.clear();
+    lruList_.clear();
+    size_ = 0;
+    journalRecords_ = 0;
+    journalBuffer_.clear();
+    unsyncedFiles_.clear();
+    ++generation_;
+    if (journal_.is_open()) {
+        journal_.close();
+    }
+    remove(GetPath(JOURNAL_FILE).c_str());
+    if (rmdir(directory_.c_str()) < 0) {
+        NETSTACK_LOGI("remove cache directory error %{public}d", errno);
+    }
+    loaded_ = false;
+}
+
+void IndexedDiskCache::Sync()
+{
+    std::lock_guard<std::mutex> syncGuard(syncMutex_);
+    std::vector<std::string> files;
+    std::string records;
+    uint64_t generation = 0;
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        if (!loaded_) {
+            return;
+        }
+        files.swap(unsyncedFiles_);
+        records.swap(journalBuffer_);
+        generation = generation_;
+    }
+    // The writer wakes up periodically, an idle cache must not touch the disk.
+    if (files.empty() && records.empty()) {
+        return;
+    }
+
+    // Entry files are synced without the index lock, lookups keep running meanwhile.
+    for (const auto &fileName : files) {
+        SyncFile(GetPath(fileName));
+    }
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (generation != generation_) {
+        return;
+    }
+    if (journal_.is_open() && !records.empty()) {
+        journal_ << records;
+        journal_.flush();
+        SyncFile(GetPath(JOURNAL_FILE));
+    }
+    SyncFile(directory_);
+    // A compacted journal lists every entry, so it waits until none of them is unsynced.
+    if (unsyncedFiles_.empty()) {
+        CompactJournalIfNeeded();
+    }
+}
+
+void IndexedDiskCache::EnsureLoaded()
+{
+    if (loaded_) {
+        return;
+    }
+    loaded_ = true;
+    if (mkdir(directory_.c_str(), CACHE_DIR_MODE) < 0 && errno != EEXIST) {
+        NETSTACK_LOGE("create cache directory error %{public}d", errno);
+    }
+    LoadJournal();
+    RemoveOrphanFiles();
+    journal_.open(GetPath(JOURNAL_FILE), std::ios::app);
+    TrimToCapacity();
+    CompactJournalIfNeeded();
+}
+
+void IndexedDiskCache::LoadJournal()
+{
+    std::ifstream r(GetPath(JOURNAL_FILE));
+    if (!r.is_open()) {
+        return;
+    }
+    std::string line;
+    while (std::getline(r, line)) {
+        std::istringstream record(line);
+        char op = 0;
+        std::string key;
+        record >> op;
+        if (op == RECORD_PUT) {
+            std::string fileName;
+            size_t size = 0;
+            if (!(record >> fileName >> size) || !ReadKey(record, key)) {
+                continue;
+            }
+            if (index_.find(key) != index_.end()) {
+                EraseEntry(key, false);
+            }
+            IndexEntry entry;
+            entry.fileName = fileName;
+            entry.size = size;
+            entry.lruIt = lruList_.insert(lruList_.begin(), key);
+            index_[key] = entry;
+            size_ += size;
+            nextFileId_ = std::max<uint64_t>(nextFileId_, std::strtoull(fileName.c_str(), nullptr, HEX_BASE) + 1);
+        } else if (op == RECORD_READ && ReadKey(record, key)) {
+            auto it = index_.find(key);
+            if (it != index_.end()) {
+                lruList_.splice(lruList_.begin(), lruList_, it->second.lruIt);
+            }
+        } else if (op == RECORD_REMOVE && ReadKey(record, key)) {
+            if (index_.find(key) != index_.end()) {
+                EraseEntry(key, false);
+            }
+        }
+        ++journalRecords_;
+    }
+}
+
+void IndexedDiskCache::RemoveOrphanFiles()
+{
+    // Entry files written but never journaled before a crash, and leftover temporaries, are not
+    // counted in size_ and would keep the directory from being removed, so they go on load.
+    DIR *dir = opendir(directory_.c_str());
+    if (dir == nullptr) {
+        return;
+    }
+    std::unordered_set<std::string> referenced;
+    for (const auto &p : index_) {
+        referenced.insert(p.second.fileName);
+    }
+    size_t removed = 0;
+    while (struct dirent *item = readdir(dir)) {
+        std::string name = item->d_name;
+        if (name == "." || name == ".." || name == JOURNAL_FILE || referenced.count(name) != 0) {
+            continue;
+        }
+        if (remove(GetPath(name).c_str()) == 0) {
+            ++removed;
+        }
+    }
+    closedir(dir);
+    if (removed > 0) {
+        NETSTACK_LOGI("removed %{public}zu orphan cache files", removed);
+    }
+}
+
+void IndexedDiskCache::AppendJournal(const std::string &record)
+{
+    if (!journal_.is_open()) {
+        return;
+    }
+    journalBuffer_ += record;
+    journalBuffer_ += '\n';
+    ++journalRecords_;
+}
+
+void IndexedDiskCache::CompactJournalIfNeeded()
+{
+    if (journalRecords_ < MIN_COMPACT_RECORDS || journalRecords_ < index_.size() * 2) {
+        return;
+    }
+    std::string tmpPath = GetPath(JOURNAL_TMP_FILE);
+    {
+        std::ofstream w(tmpPath, std::ios::trunc);
+        if (!w.is_open()) {
+            return;
+        }
+        // Least recently used first, so the replay rebuilds the same order.
+        for (auto it = lruList_.rbegin(); it != lruList_.rend(); ++it) {
+            const auto &entry = index_[*it];
+            w << RECORD_PUT << ' ' << entry.fileName << ' ' << entry.size << ' ' << *it << '\n';
+        }
+    }
+    SyncFile(tmpPath);
+    if (journal_.is_open()) {
+        journal_.close();
+    }
+    if (rename(tmpPath.c_str(), GetPath(JOURNAL_FILE).c_str()) < 0) {
+        NETSTACK_LOGE("compact cache journal failed %{public}d", errno);
+        remove(tmpPath.c_str());
+    } else {
+        journalRecords_ = index_.size();
+        journalBuffer_.clear();
+    }
+    journal_.open(GetPath(JOURNAL_FILE), std::ios::app);
+}
+
+void IndexedDiskCache::CommitEntry(const std::string &key, const std::string &fileName, size_t size)
+{
+    EnsureLoaded();
+    if (index_.find(key) != index_.end()) {
+        EraseEntry(key, true);
+    }
+    IndexEntry entry;
+    entry.fileName = fileName;
+    entry.size = size;
+    entry.lruIt = lruList_.insert(lruList_.begin(), key);
+    index_[key] = entry;
+    size_ += size;
+
+    std::ostringstream record;
+    record << RECORD_PUT << ' ' << fileName << ' ' << size << ' ' << key;
+    AppendJournal(record.str());
+    unsyncedFiles_.push_back(fileName);
+    TrimToCapacity();
+}
+
+void IndexedDiskCache::EraseEntry(const std::string &key, bool removeFile)
+{
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+        return;
+    }
+    if (removeFile) {
+        remove(GetPath(it->second.fileName).c_str());
+        AppendJournal(std::string(1, RECORD_REMOVE) + " " + key);
+    }
+    size_ -= std::min(size_, it->second.size);
+    lruList_.erase(it->second.lruIt);
+    index_.erase(it);
+}
+
+void IndexedDiskCache::TrimToCapacity()
+{
+    while (size_ > capacity_ && !lruList_.empty()) {
+        std::string key = lruList_.back();
+        EraseEntry(key, true);
+    }
+}
+
+std::string IndexedDiskCache::GetPath(const std::string &fileName) const
+{
+    return directory_ + "/" + fileName;
+}
+} // namespace OHOS::NetStack::Http
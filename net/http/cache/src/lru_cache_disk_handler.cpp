@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "lru_cache_disk_handler.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <sys/stat.h>
+
+#include "netstack_log.h"
+
+static constexpr const char *DISK_CACHE_DIR_SUFFIX = ".d";
+
+namespace OHOS::NetStack::Http {
+static size_t ClampCapacity(size_t capacity)
+{
+    return std::max<size_t>(std::min<size_t>(MAX_DISK_CACHE_SIZE, capacity), MIN_DISK_CACHE_SIZE);
+}
+
+static size_t GetValueSize(const std::unordered_map<std::string, std::string> &value)
+{
+    size_t size = 0;
+    for (const auto &p : value) {
+        size += p.first.size() + p.second.size();
+    }
+    return size;
+}
+
+LRUCacheDiskHandler::LRUCacheDiskHandler(std::string fileName, size_t capacity)
+    : fileName_(std::move(fileName)),
+      diskCache_(fileName_ + DISK_CACHE_DIR_SUFFIX, ClampCapacity(capacity))
+{
+}
+
+void LRUCacheDiskHandler::SetCapacity(size_t capacity)
+{
+    diskCache_.SetCapacity(ClampCapacity(capacity));
+}
+
+void LRUCacheDiskHandler::Delete()
+{
+    std::lock_guard<std::mutex> flushGuard(flushMutex_);
+    cache_.Clear();
+    {
+        std::lock_guard<std::mutex> guard(pendingMutex_);
+        pending_.clear();
+        pendingSize_ = 0;
+    }
+    diskCache_.Delete();
+}
+
+void LRUCacheDiskHandler::WriteCacheToDisk()
+{
+    std::lock_guard<std::mutex> flushGuard(flushMutex_);
+    {
+        std::lock_guard<std::mutex> guard(pendingMutex_);
+        flushing_.swap(pending_);
+        pendingSize_ = 0;
+    }
+    // Entries stay visible through flushing_ until the disk cache has them.
+    for (const auto &p : flushing_) {
+        diskCache_.Put(p.first, p.second.metadata, p.second.body);
+    }
+    {
+        std::lock_guard<std::mutex> guard(pendingMutex_);
+        flushing_.clear();
+    }
+    diskCache_.Sync();
+}
+
+void LRUCacheDiskHandler::ReadCacheFromDisk()
+{
+    // The single JSON file written by older versions is not migrated, it is only a cache.
+    struct stat st {};
+    if (stat(fileName_.c_str(), &st) == 0 && S_ISREG(st.st_mode) && remove(fileName_.c_str()) < 0) {
+        NETSTACK_LOGI("remove legacy cache file error %{public}d", errno);
+    }
+}
+
+bool LRUCacheDiskHandler::FindPending(const PendingMap &entries, const std::string &key,
+    std::unordered_map<std::string, std::string> &metadata, std::string &body)
+{
+    auto it = entries.find(key);
+    if (it == entries.end()) {
+        return false;
+    }
+    metadata = it->second.metadata;
+    body = it->second.body;
+    return true;
+}
+
+std::unordered_map<std::string, std::string> LRUCacheDiskHandler::Get(const std::string &key, std::string &body)
+{
+    std::unordered_map<std::string, std::string> metadata;
+    {
+        std::lock_guard<std::mutex> guard(pendingMutex_);
+        if (FindPending(pending_, key, metadata, body) || FindPending(flushing_, key, metadata, body)) {
+            return metadata;
+        }
+    }
+
+    auto cached = cache_.Get(key);
+    if (cached != nullptr && diskCache_.ReadBody(*cached, body)) {
+        return *cached;
+    }
+
+    // The memory metadata may point to an entry that was replaced or evicted since.
+    metadata = diskCache_.Get(key);
+    if (metadata.empty() || !diskCache_.ReadBody(metadata, body)) {
+        return {};
+    }
+    cache_.Put(key, LRUCache::Entry(metadata));
+    return metadata;
+}
+
+bool LRUCacheDiskHandler::Put(const std::string &key, const std::unordered_map<std::string, std::string> &metadata,
+    const std::string &body)
+{
+    std::lock_guard<std::mutex> guard(pendingMutex_);
+    size_t oldSize = 0;
+    auto it = pending_.find(key);
+    if (it != pending_.end()) {
+        oldSize = GetValueSize(it->second.metadata) + it->second.body.size();
+    }
+    size_t newSize = GetValueSize(metadata) + body.size();
+    if (newSize > MIN_DISK_CACHE_SIZE) {
+        NETSTACK_LOGI("cache entry of %{public}zu bytes exceeds the pending limit, skip it", newSize);
+        return pendingSize_ >= WRITE_BEHIND_BATCH_SIZE;
+    }
+    // The caller is a request thread, so when the writer falls behind the entry is dropped instead of written here.
+    if (pendingSize_ - std::min(pendingSize_, oldSize) + newSize > MIN_DISK_CACHE_SIZE) {
+        NETSTACK_LOGI("cache writer is behind, skip this entry");
+        return true;
+    }
+    pendingSize_ = pendingSize_ - std::min(pendingSize_, oldSize) + newSize;
+    pending_[key] = PendingEntry { metadata, body };
+    return pendingSize_ >= WRITE_BEHIND_BATCH_SIZE;
+}
+} // namespace OHOS::NetStack::Http
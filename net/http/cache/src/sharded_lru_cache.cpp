@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sharded_lru_cache.h"
+
+#include <algorithm>
+#include <functional>
+
+static constexpr const size_t DEFAULT_CAPACITY = 1024 * 1024;
+
+namespace OHOS::NetStack::Http {
+ShardedLRUCache::ShardedLRUCache() : ShardedLRUCache(DEFAULT_CAPACITY) {}
+
+ShardedLRUCache::ShardedLRUCache(size_t capacity, size_t shardCount) : capacity_(capacity)
+{
+    shardCount = std::max<size_t>(shardCount, 1);
+    shards_.reserve(shardCount);
+    for (size_t i = 0; i < shardCount; ++i) {
+        // Every shard may grow up to the whole budget, the shared limit is enforced in EvictIfNeeded.
+        shards_.emplace_back(std::make_unique<LRUCache>(capacity));
+    }
+}
+
+LRUCache &ShardedLRUCache::GetShard(size_t index)
+{
+    return *shards_[index];
+}
+
+size_t ShardedLRUCache::GetShardIndex(const std::string &key) const
+{
+    return std::hash<std::string>()(key) % shards_.size();
+}
+
+LRUCache::EntryPtr ShardedLRUCache::Get(const std::string &key)
+{
+    return GetShard(GetShardIndex(key)).Get(key);
+}
+
+void ShardedLRUCache::Put(const std::string &key, LRUCache::Entry value)
+{
+    Put(key, std::make_shared<const LRUCache::Entry>(std::move(value)));
+}
+
+void ShardedLRUCache::Put(const std::string &key, LRUCache::EntryPtr value)
+{
+    size_t index = GetShardIndex(key);
+    GetShard(index).Put(key, std::move(value));
+    EvictIfNeeded(index);
+}
+
+void ShardedLRUCache::Clear()
+{
+    for (auto &shard : shards_) {
+        shard->Clear();
+    }
+}
+
+size_t ShardedLRUCache::GetSize() const
+{
+    size_t size = 0;
+    for (const auto &shard : shards_) {
+        size += shard->GetSize();
+    }
+    return size;
+}
+
+void ShardedLRUCache::EvictIfNeeded(size_t shardIndex)
+{
+    // Only one shard lock is held at a time, concurrent puts may overshoot the budget briefly.
+    LRUCache &own = GetShard(shardIndex);
+    size_t fairShare = capacity_ / shards_.size();
+    while (GetSize() > capacity_ && own.GetSize() > fairShare) {
+        if (!own.EraseTail()) {
+            break;
+        }
+    }
+    size_t idle = 0;
+    while (GetSize() > capacity_ && idle < shards_.size()) {
+        size_t index = evictCursor_.fetch_add(1, std::memory_order_relaxed) % shards_.size();
+        if (index != shardIndex && GetShard(index).EraseTail()) {
+            idle = 0;
+        } else {
+            ++idle;
+        }
+    }
+    while (GetSize() > capacity_) {
+        if (!own.EraseTail()) {
+            break;
+        }
+    }
+}
+} // namespace OHOS::NetStack::Http
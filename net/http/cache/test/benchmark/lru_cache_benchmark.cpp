@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "lru_cache.h"
+#include "sharded_lru_cache.h"
+
+/*
+ * Throughput of the HTTP memory cache with several threads hitting one
+ * instance, and how the single-lock and the sharded cache scale with the
+ * thread count. Every thread runs its operation until --min-time elapsed, the
+ * totals of all threads are reported.
+ */
+namespace OHOS::NetStack::Http {
+namespace {
+using Clock = std::chrono::steady_clock;
+
+constexpr double DEFAULT_MIN_SECONDS = 0.5;
+constexpr size_t BATCH_ITERATIONS = 64;
+constexpr double NS_PER_SECOND = 1e9;
+constexpr double OPS_PER_MOPS = 1e6;
+constexpr size_t MIN_THREADS = 4;
+
+// The cache clamps its capacity to 1 MB, the benchmark uses the whole budget.
+constexpr size_t CACHE_CAPACITY = 1024 * 1024;
+// Share of the capacity filled before hits are measured, so no hit evicts.
+constexpr size_t RESIDENT_PERCENT = 75;
+constexpr size_t PERCENT = 100;
+constexpr size_t SMALL_ENTRY_BYTES = 1024;
+constexpr size_t LARGE_ENTRY_BYTES = 256 * 1024;
+// Distinct keys each thread cycles through for misses and evictions.
+constexpr size_t KEYS_PER_THREAD = 4096;
+// One put per this many operations in the mixed scaling workload.
+constexpr size_t MIXED_PUT_INTERVAL = 10;
+
+struct BenchResult {
+    std::string cache;
+    std::string operation;
+    size_t threads = 0;
+    size_t entryBytes = 0;
+    size_t operations = 0;
+    double nsPerOp = 0;
+    double mopsPerSecond = 0;
+};
+
+double g_minSeconds = DEFAULT_MIN_SECONDS;
+size_t g_maxThreads = std::max<size_t>(MIN_THREADS, std::thread::hardware_concurrency());
+std::vector<BenchResult> g_results;
+
+// Runs body(thread, iteration) on |threads| threads at once for g_minSeconds.
+void MeasureThreads(const std::string& cache, const std::string& operation, size_t threads, size_t entryBytes,
+    const std::function<void(size_t, size_t)>& body)
+{
+    std::atomic<size_t> ready(0);
+    std::atomic<bool> go(false);
+    std::atomic<bool> stop(false);
+    std::vector<size_t> counts(threads, 0);
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threads; t++) {
+        workers.emplace_back([&, t]() {
+            ready++;
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            size_t iteration = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                for (size_t i = 0; i < BATCH_ITERATIONS; i++) {
+                    body(t, iteration++);
+                }
+            }
+            counts[t] = iteration;
+        });
+    }
+    while (ready.load() < threads) {
+        std::this_thread::yield();
+    }
+    auto start = Clock::now();
+    go.store(true, std::memory_order_release);
+    std::this_thread::sleep_for(std::chrono::duration<double>(g_minSeconds));
+    stop.store(true, std::memory_order_relaxed);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+    BenchResult result { cache, operation, threads, entryBytes };
+    for (size_t count : counts) {
+        result.operations += count;
+    }
+    // Wall time per operation of one thread, and the throughput of all threads together.
+    result.nsPerOp = elapsed * NS_PER_SECOND * threads / std::max<size_t>(result.operations, 1);
+    result.mopsPerSecond = result.operations / elapsed / OPS_PER_MOPS;
+    g_results.push_back(result);
+}
+
+LRUCache::EntryPtr CreateEntry(size_t entryBytes)
+{
+    LRUCache::Entry entry;
+    entry["headers"] = "content-type: application/json";
+    entry["body"] = std::string(entryBytes - entry["headers"].size(), 'x');
+    return std::make_shared<const LRUCache::Entry>(std::move(entry));
+}
+
+std::vector<std::string> CreateKeys(const std::string& prefix, size_t count)
+{
+    std::vector<std::string> keys;
+    keys.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        keys.push_back("https://example.com/" + prefix + "/" + std::to_string(i));
+    }
+    return keys;
+}
+
+std::vector<std::vector<std::string>> CreateThreadKeys(const std::string& prefix, size_t threads)
+{
+    std::vector<std::vector<std::string>> keys;
+    for (size_t t = 0; t < threads; t++) {
+        keys.push_back(CreateKeys(prefix + std::to_string(t), KEYS_PER_THREAD));
+    }
+    return keys;
+}
+
+template <typename Cache>
+void RunContentionBenchmarks(const std::string& name, size_t entryBytes, size_t threads)
+{
+    LRUCache::EntryPtr entry = CreateEntry(entryBytes);
+    std::vector<std::string> resident =
+        CreateKeys("resident", std::max<size_t>(CACHE_CAPACITY * RESIDENT_PERCENT / PERCENT / entryBytes, 1));
+
+    Cache hitCache(CACHE_CAPACITY);
+    for (const auto& key : resident) {
+        hitCache.Put(key, entry);
+    }
+    MeasureThreads(name, "hit", threads, entryBytes, [&hitCache, &resident](size_t thread, size_t iteration) {
+        // Threads start at different keys, so they do not move the same node in lockstep.
+        hitCache.Get(resident[(thread + iteration) % resident.size()]);
+    });
+
+    std::vector<std::vector<std::string>> absent = CreateThreadKeys("absent", threads);
+    MeasureThreads(name, "miss", threads, entryBytes, [&hitCache, &absent](size_t thread, size_t iteration) {
+        hitCache.Get(absent[thread][iteration % KEYS_PER_THREAD]);
+    });
+
+    // Far more keys than fit, so once the cache is full every put evicts the tail.
+    Cache evictCache(CACHE_CAPACITY);
+    for (const auto& key : resident) {
+        evictCache.Put(key, entry);
+    }
+    std::vector<std::vector<std::string>> fresh = CreateThreadKeys("fresh", threads);
+    MeasureThreads(name, "evict", threads, entryBytes,
+        [&evictCache, &fresh, &entry](size_t thread, size_t iteration) {
+            evictCache.Put(fresh[thread][iteration % KEYS_PER_THREAD], entry);
+        });
+}
+
+void RunLruBenchmarks()
+{
+    for (size_t entryBytes : { SMALL_ENTRY_BYTES, LARGE_ENTRY_BYTES }) {
+        for (size_t threads : { static_cast<size_t>(1), g_maxThreads }) {
+            RunContentionBenchmarks<LRUCache>("lru", entryBytes, threads);
+        }
+    }
+}
+
+// Mixed gets and puts on resident keys, for 1, 2, 4, ... g_maxThreads threads.
+template <typename Cache>
+void RunScalingBenchmarks(const std::string& name)
+{
+    LRUCache::EntryPtr entry = CreateEntry(SMALL_ENTRY_BYTES);
+    std::vector<std::string> resident =
+        CreateKeys("resident", CACHE_CAPACITY * RESIDENT_PERCENT / PERCENT / SMALL_ENTRY_BYTES);
+    std::vector<size_t> threadCounts;
+    for (size_t threads = 1; threads < g_maxThreads; threads *= 2) {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(g_maxThreads);
+    for (size_t threads : threadCounts) {
+        Cache cache(CACHE_CAPACITY);
+        for (const auto& key : resident) {
+            cache.Put(key, entry);
+        }
+        MeasureThreads(name, "mixed", threads, SMALL_ENTRY_BYTES,
+            [&cache, &resident, &entry](size_t thread, size_t iteration) {
+                const std::string& key = resident[(thread * KEYS_PER_THREAD + iteration) % resident.size()];
+                if (iteration % MIXED_PUT_INTERVAL == 0) {
+                    cache.Put(key, entry);
+                } else {
+                    cache.Get(key);
+                }
+            });
+    }
+}
+
+void PrintJson()
+{
+    printf("{\"benchmark\":\"http_lru_cache\",\"min_time_s\":%g,\"hardware_threads\":%u,\"results\":[",
+        g_minSeconds, std::thread::hardware_concurrency());
+    for (size_t i = 0; i < g_results.size(); i++) {
+        const BenchResult& r = g_results[i];
+        printf("%s\n{\"cache\":\"%s\",\"op\":\"%s\",\"threads\":%zu,\"entry_bytes\":%zu,\"ops\":%zu,"
+            "\"ns_per_op\":%.1f,\"mops_per_s\":%.3f}", i == 0 ? "" : ",", r.cache.c_str(), r.operation.c_str(),
+            r.threads, r.entryBytes, r.operations, r.nsPerOp, r.mopsPerSecond);
+    }
+    printf("\n]}\n");
+}
+
+void PrintCsv()
+{
+    printf("cache,op,threads,entry_bytes,ops,ns_per_op,mops_per_s\n");
+    for (const auto& r : g_results) {
+        printf("%s,%s,%zu,%zu,%zu,%.1f,%.3f\n", r.cache.c_str(), r.operation.c_str(), r.threads, r.entryBytes,
+            r.operations, r.nsPerOp, r.mopsPerSecond);
+    }
+}
+} // namespace
+} // namespace OHOS::NetStack::Http
+
+int main(int argc, char* argv[])
+{
+    using namespace OHOS::NetStack::Http;
+    bool csv = false;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--format=csv") {
+            csv = true;
+        } else if (arg == "--format=json") {
+            csv = false;
+        } else if (arg.rfind("--min-time=", 0) == 0) {
+            g_minSeconds = std::atof(arg.c_str() + strlen("--min-time="));
+        } else if (arg.rfind("--threads=", 0) == 0) {
+            g_maxThreads = std::max(std::atoi(arg.c_str() + strlen("--threads=")), 1);
+        } else {
+            fprintf(stderr, "Usage: %s [--format=json|csv] [--min-time=<seconds>] [--threads=<max>]\n", argv[0]);
+            return 1;
+        }
+    }
+    RunLruBenchmarks();
+    RunScalingBenchmarks<LRUCache>("lru");
+    RunScalingBenchmarks<ShardedLRUCache>("sharded");
+    if (csv) {
+        PrintCsv();
+    } else {
+        PrintJson();
+    }
+    return 0;
+}
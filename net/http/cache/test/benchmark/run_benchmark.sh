@@ -0,0 +1,36 @@
+#!/bin/bash
+# Copyright (c) 2026 Huawei Device Co., Ltd.
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# Builds http_lru_cache_benchmark with the host compiler and runs it, without GN.
+#
+# Usage: ./run_benchmark.sh [--format=json|csv] [--min-time=<seconds>] [--threads=<max>]
+#
+#   CXX      host C++ compiler (default g++)
+#   OUT_DIR  build directory (default ${TMPDIR:-/tmp}/http_lru_cache_benchmark)
+
+set -euo pipefail
+
+SCRIPT_DIR="$(cd "$(dirname "$0")" && pwd)"
+CACHE_DIR="$(cd "${SCRIPT_DIR}/../.." && pwd)"
+CXX="${CXX:-g++}"
+OUT_DIR="${OUT_DIR:-${TMPDIR:-/tmp}/http_lru_cache_benchmark}"
+
+mkdir -p "${OUT_DIR}"
+
+"${CXX}" -std=c++17 -O2 -pthread \
+    -I"${SCRIPT_DIR}/host_include" -I"${CACHE_DIR}/include" \
+    "${CACHE_DIR}/src/lru_cache.cpp" "${CACHE_DIR}/src/sharded_lru_cache.cpp" \
+    "${SCRIPT_DIR}/lru_cache_benchmark.cpp" \
+    -o "${OUT_DIR}/http_lru_cache_benchmark"
+
+"${OUT_DIR}/http_lru_cache_benchmark" "$@"
@@ -50,6 +50,96 @@ static constexpr const char *DELETE_ASYNC_WORK_NAME = "ExecDelete";
 
 static constexpr const char *HTTP_MODULE_NAME = "net.http";
 
+#ifdef ANDROID_PLATFORM
+static constexpr const char *FUNCTION_SET_CONNECTION_POLICY = "setConnectionPolicy";
+static constexpr const char *FUNCTION_GET_CONNECTION_POLICY = "getConnectionPolicy";
+static constexpr const char *FUNCTION_SET_MAPPED_BODY_THRESHOLD = "setMappedBodyThreshold";
+static constexpr const char *FUNCTION_GET_MAPPED_BODY_THRESHOLD = "getMappedBodyThreshold";
+static constexpr const char *POLICY_HANDLE_POOL_SIZE = "handlePoolSize";
+static constexpr const char *POLICY_KEEP_ALIVE = "keepAlive";
+static constexpr const char *POLICY_KEEP_ALIVE_IDLE_SECONDS = "keepAliveIdleSeconds";
+static constexpr const char *POLICY_MULTIPLEX = "multiplex";
+static constexpr const char *POLICY_MAX_HOST_CONNECTIONS = "maxHostConnections";
+static constexpr const char *POLICY_MAX_ACTIVE_REQUESTS = "maxActiveRequests";
+static constexpr const char *POLICY_RESERVED_HIGH_PRIORITY_SLOTS = "reservedHighPrioritySlots";
+static constexpr const char *POLICY_HIGH_PRIORITY = "highPriority";
+
+template <typename T> static void GetPolicyField(napi_env env, napi_value object, const char *name, T &field)
+{
+    if (NapiUtils::HasNamedProperty(env, object, name)) {
+        field = static_cast<T>(NapiUtils::GetUint32Property(env, object, name));
+    }
+}
+
+// Fields missing from the object keep their current value.
+static napi_value SetConnectionPolicy(napi_env env, napi_callback_info info)
+{
+    napi_value thisVal = nullptr;
+    size_t paramsCount = MAX_PARAM_NUM;
+    napi_value params[MAX_PARAM_NUM] = {nullptr};
+    NAPI_CALL(env, napi_get_cb_info(env, info, &paramsCount, params, &thisVal, nullptr));
+    if (paramsCount != 1 || NapiUtils::GetValueType(env, params[0]) != napi_object) {
+        NETSTACK_LOGE("setConnectionPolicy needs a policy object");
+        return NapiUtils::GetUndefined(env);
+    }
+
+    auto policy = HttpExec::GetConnectionPolicy();
+    GetPolicyField(env, params[0], POLICY_HANDLE_POOL_SIZE, policy.handlePoolSize);
+    if (NapiUtils::HasNamedProperty(env, params[0], POLICY_KEEP_ALIVE)) {
+        policy.keepAlive = NapiUtils::GetBooleanProperty(env, params[0], POLICY_KEEP_ALIVE);
+    }
+    GetPolicyField(env, params[0], POLICY_KEEP_ALIVE_IDLE_SECONDS, policy.keepAliveIdleSeconds);
+    if (NapiUtils::HasNamedProperty(env, params[0], POLICY_MULTIPLEX)) {
+        policy.multiplex = NapiUtils::GetBooleanProperty(env, params[0], POLICY_MULTIPLEX);
+    }
+    GetPolicyField(env, params[0], POLICY_MAX_HOST_CONNECTIONS, policy.maxHostConnections);
+    GetPolicyField(env, params[0], POLICY_MAX_ACTIVE_REQUESTS, policy.maxActiveRequests);
+    GetPolicyField(env, params[0], POLICY_RESERVED_HIGH_PRIORITY_SLOTS, policy.reservedHighPrioritySlots);
+    GetPolicyField(env, params[0], POLICY_HIGH_PRIORITY, policy.highPriority);
+    HttpExec::SetConnectionPolicy(policy);
+    return NapiUtils::GetUndefined(env);
+}
+
+static napi_value GetConnectionPolicy(napi_env env, napi_callback_info info)
+{
+    auto policy = HttpExec::GetConnectionPolicy();
+    napi_value object = NapiUtils::CreateObject(env);
+    NapiUtils::SetUint32Property(env, object, POLICY_HANDLE_POOL_SIZE, static_cast<uint32_t>(policy.handlePoolSize));
+    NapiUtils::SetBooleanProperty(env, object, POLICY_KEEP_ALIVE, policy.keepAlive);
+    NapiUtils::SetUint32Property(env, object, POLICY_KEEP_ALIVE_IDLE_SECONDS,
+        static_cast<uint32_t>(policy.keepAliveIdleSeconds));
+    NapiUtils::SetBooleanProperty(env, object, POLICY_MULTIPLEX, policy.multiplex);
+    NapiUtils::SetUint32Property(env, object, POLICY_MAX_HOST_CONNECTIONS,
+        static_cast<uint32_t>(policy.maxHostConnections));
+    NapiUtils::SetUint32Property(env, object, POLICY_MAX_ACTIVE_REQUESTS,
+        static_cast<uint32_t>(policy.maxActiveRequests));
+    NapiUtils::SetUint32Property(env, object, POLICY_RESERVED_HIGH_PRIORITY_SLOTS,
+        static_cast<uint32_t>(policy.reservedHighPrioritySlots));
+    NapiUtils::SetUint32Property(env, object, POLICY_HIGH_PRIORITY, policy.highPriority);
+    return object;
+}
+
+// ArrayBuffer responses announced at least this many bytes are received into a mapping, 0 turns it off.
+static napi_value SetMappedBodyThreshold(napi_env env, napi_callback_info info)
+{
+    napi_value thisVal = nullptr;
+    size_t paramsCount = MAX_PARAM_NUM;
+    napi_value params[MAX_PARAM_NUM] = {nullptr};
+    NAPI_CALL(env, napi_get_cb_info(env, info, &paramsCount, params, &thisVal, nullptr));
+    if (paramsCount != 1 || NapiUtils::GetValueType(env, params[0]) != napi_number) {
+        NETSTACK_LOGE("setMappedBodyThreshold needs a size in bytes");
+        return NapiUtils::GetUndefined(env);
+    }
+    HttpExec::SetMappedBodyThreshold(NapiUtils::GetUint32FromValue(env, params[0]));
+    return NapiUtils::GetUndefined(env);
+}
+
+static napi_value GetMappedBodyThreshold(napi_env env, napi_callback_info info)
+{
+    return NapiUtils::CreateUint32(env, static_cast<uint32_t>(HttpExec::GetMappedBodyThreshold()));
+}
+#endif
+
 napi_value HttpModuleExports::InitHttpModule(napi_env env, napi_value exports)
 {
     DefineHttpRequestClass(env, exports);
@@ -121,6 +211,15 @@ void HttpModuleExports::InitHttpProperties(napi_env env, napi_value exports)
         DECLARE_NAPI_FUNCTION(FUNCTION_CREATE_HTTP_RESPONSE_CACHE, CreateHttpResponseCache),
     };
     NapiUtils::DefineProperties(env, exports, properties);
+#ifdef ANDROID_PLATFORM
+    std::initializer_list<napi_property_descriptor> execProperties = {
+        DECLARE_NAPI_FUNCTION(FUNCTION_SET_CONNECTION_POLICY, SetConnectionPolicy),
+        DECLARE_NAPI_FUNCTION(FUNCTION_GET_CONNECTION_POLICY, GetConnectionPolicy),
+        DECLARE_NAPI_FUNCTION(FUNCTION_SET_MAPPED_BODY_THRESHOLD, SetMappedBodyThreshold),
+        DECLARE_NAPI_FUNCTION(FUNCTION_GET_MAPPED_BODY_THRESHOLD, GetMappedBodyThreshold),
+    };
+    NapiUtils::DefineProperties(env, exports, execProperties);
+#endif
 
     InitRequestMethod(env, exports);
     InitResponseCode(env, exports);
@@ -117,6 +117,7 @@ typedef struct {
 napi_status napi_create_object(napi_env env, napi_value* result);
 napi_status napi_create_int32(napi_env env, int32_t value, napi_value* result);
 napi_status napi_create_string_utf8(napi_env env, const char* str, size_t length, napi_value* result);
+napi_status napi_create_string_latin1(napi_env env, const char* str, size_t length, napi_value* result);
 napi_status napi_create_array(napi_env env, napi_value* result);
 napi_status napi_create_array_with_length(napi_env env, size_t length, napi_value* result);
 napi_status napi_create_double(napi_env env, double value, napi_value* result);
@@ -133,6 +134,7 @@ napi_status napi_set_named_property(napi_env env, napi_value object, const char*
 napi_status napi_has_named_property(napi_env env, napi_value object, const char* utf8name, bool* result);
 napi_status napi_get_named_property(napi_env env, napi_value object, const char* utf8name, napi_value* result);
 napi_status napi_get_property(napi_env env, napi_value object, napi_value key, napi_value* result);
+napi_status napi_set_property(napi_env env, napi_value object, napi_value key, napi_value value);
 napi_status napi_is_callable(napi_env env, napi_value value, bool* result);
 
 // Value extraction
@@ -243,6 +245,9 @@ napi_status napi_get_value_double(napi_env env, napi_value value, double* result
 // ArrayBuffer operations
 napi_status napi_is_arraybuffer(napi_env env, napi_value value, bool* result);
 napi_status napi_get_arraybuffer_info(napi_env env, napi_value arraybuffer, void** data, size_t* byte_length);
+napi_status napi_is_detached_arraybuffer(napi_env env, napi_value value, bool* result);
+napi_status napi_detach_arraybuffer(napi_env env, napi_value arraybuffer);
+napi_status napi_is_typedarray(napi_env env, napi_value value, bool* result);
 
 // Reference management (extended)
 napi_status napi_reference_unref(napi_env env, napi_ref ref, uint32_t* result);
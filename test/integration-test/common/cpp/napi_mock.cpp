@@ -209,6 +209,10 @@ napi_status napi_create_string_utf8(napi_env env, const char* str, size_t length
     return napi_ok;
 }
 
+napi_status napi_create_string_latin1(napi_env env, const char* str, size_t length, napi_value* result) {
+    return napi_create_string_utf8(env, str, length, result);
+}
+
 napi_status napi_create_array(napi_env env, napi_value* result) {
     MockNapiValue* val = allocValue();
     val->type = MockNapiValueType::ARRAY;
@@ -705,6 +709,15 @@ napi_status napi_strict_equals(napi_env env, napi_value lhs, napi_value rhs, boo
 napi_status napi_get_property_names(napi_env env, napi_value object, napi_value* result) {
     MockNapiValue* val = allocValue();
     val->type = MockNapiValueType::ARRAY;
+    MockNapiValue* obj = toMock(object);
+    if (obj) {
+        for (const auto& property : obj->properties) {
+            MockNapiValue* name = allocValue();
+            name->type = MockNapiValueType::STRING;
+            name->strVal = property.first;
+            val->arrayElements.push_back(name);
+        }
+    }
     if (result) { *result = static_cast<napi_value>(val); }
     return napi_ok;
 }
@@ -815,6 +828,24 @@ napi_status napi_get_arraybuffer_info(napi_env env, napi_value arraybuffer, void
     return napi_ok;
 }
 
+napi_status napi_is_detached_arraybuffer(napi_env env, napi_value value, bool* result) {
+    if (result) { *result = false; }
+    return napi_ok;
+}
+
+napi_status napi_detach_arraybuffer(napi_env env, napi_value arraybuffer) {
+    MockNapiValue* v = toMock(arraybuffer);
+    if (v && v->type == MockNapiValueType::ARRAYBUFFER) {
+        v->bufferData.clear();
+    }
+    return napi_ok;
+}
+
+napi_status napi_is_typedarray(napi_env env, napi_value value, bool* result) {
+    if (result) { *result = false; }
+    return napi_ok;
+}
+
 // --- Reference management (extended) ---
 
 napi_status napi_reference_unref(napi_env env, napi_ref ref, uint32_t* result) {
@@ -868,6 +899,20 @@ napi_status napi_get_property(napi_env env, napi_value object, napi_value key, n
     return napi_ok;
 }
 
+napi_status napi_set_property(napi_env env, napi_value object, napi_value key, napi_value value) {
+    MockNapiValue* obj = toMock(object);
+    MockNapiValue* keyVal = toMock(key);
+    if (!obj || !keyVal) {
+        return napi_invalid_arg;
+    }
+    std::string name = keyVal->strVal;
+    if (keyVal->type == MockNapiValueType::INT32) {
+        name = std::to_string(keyVal->intVal);
+    }
+    obj->properties[name] = toMock(value);
+    return napi_ok;
+}
+
 napi_status napi_is_callable(napi_env env, napi_value value, bool* result) {
     if (result) {
         MockNapiValue* v = toMock(value);
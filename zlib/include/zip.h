@@ -30,6 +30,12 @@ namespace AppExecFwk {
 namespace LIBZIP {
 
 class WriterDelegate;
+
+// Result of extracting one file entry of an archive.
+struct UnzipEntryResult {
+    FilePath path;
+    ErrCode result = ERR_OK;
+};
 // Abstraction for file access operation required by Zip().
 // Can be passed to the ZipParams for providing custom access to the files,
 // for example over IPC.
@@ -161,6 +167,18 @@ bool Zip(const std::string& srcPath, const std::string& destPath, bool includeHi
 bool Unzip(const std::string& srcFile, const std::string& destFile, const OPTIONS options,
     std::shared_ptr<ZlibCallbackInfo> zlibCallbackInfo);
 
+// Unzips synchronously on the calling thread. |entryResults| receives the result of every
+// file entry that was attempted, in archive order; the first failure is returned. With
+// options.parallel above 1 every entry is attempted, otherwise extraction stops at the
+// first failure.
+ErrCode Unzip(const std::string& srcFile, const std::string& destFile, const OPTIONS& options,
+    std::vector<UnzipEntryResult>& entryResults);
+
+// Extracts the single entry named |entryName| into destFile, at its path inside the zip.
+// The entry is located through the cached entry index of the archive instead of a scan.
+ErrCode UnzipSingleEntry(const std::string& srcFile, const std::string& entryName, const std::string& destFile,
+    const OPTIONS& options);
+
 } // namespace LIBZIP
 } // namespace AppExecFwk
 } // namespace OHOS
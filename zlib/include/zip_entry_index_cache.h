@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_STANDARD_TOOLS_ZIP_ENTRY_INDEX_CACHE_H_
+#define FOUNDATION_APPEXECFWK_STANDARD_TOOLS_ZIP_ENTRY_INDEX_CACHE_H_
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <stddef.h>
+#include <string>
+#include <sys/stat.h>
+#include <unordered_map>
+
+#include "contrib/minizip/unzip.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace LIBZIP {
+
+// Maps an entry name to its position in the central directory.
+using ZipEntryIndex = std::unordered_map<std::string, unz64_file_pos>;
+
+// Keeps the entry indexes of the most recently opened archives. An index is
+// only handed out while the size and modification time of its archive are
+// unchanged, a replaced file is dropped on lookup.
+class ZipEntryIndexCache {
+public:
+    // Number of archives whose entry index is kept by GetInstance().
+    static constexpr size_t DEFAULT_CAPACITY = 16;
+
+    explicit ZipEntryIndexCache(size_t capacity);
+    ~ZipEntryIndexCache() = default;
+
+    static ZipEntryIndexCache& GetInstance();
+
+    std::shared_ptr<const ZipEntryIndex> Find(const std::string& path, const struct stat& fileStat);
+    void Insert(const std::string& path, const struct stat& fileStat, std::shared_ptr<const ZipEntryIndex> index);
+    size_t Size();
+
+private:
+    struct CachedEntryIndex {
+        std::string path;
+        off_t size = 0;
+        struct timespec modified = {};
+        std::shared_ptr<const ZipEntryIndex> index;
+    };
+
+    static bool IsSameFile(const CachedEntryIndex& cached, const struct stat& fileStat);
+
+    size_t capacity_;
+    std::mutex mutex_;
+    // Most recently used first.
+    std::list<CachedEntryIndex> entries_;
+
+    ZipEntryIndexCache(const ZipEntryIndexCache&) = delete;
+    ZipEntryIndexCache& operator=(const ZipEntryIndexCache&) = delete;
+};
+
+} // namespace LIBZIP
+} // namespace AppExecFwk
+} // namespace OHOS
+#endif // FOUNDATION_APPEXECFWK_STANDARD_TOOLS_ZIP_ENTRY_INDEX_CACHE_H_
@@ -28,7 +28,6 @@ namespace AppExecFwk {
 namespace LIBZIP {
 namespace {
 const int kZipMaxPath = 256;
-const int kZipBufSize = 8192;
 } // namespace
 
 // Callback function for zlib that opens a file stream from a file descriptor.
@@ -62,8 +61,10 @@ zipFile OpenForZipping(const std::string& fileNameUtf8, int appendFlag);
 // passed to zipOpen2().
 zipFile OpenFdForZipping(PlatformFile zipFd, int appendFlag);
 
-bool ZipOpenNewFileInZip(
-    zipFile zipFile, const std::string& strPath, const OPTIONS& options, const struct tm* lastModifiedTime);
+// Opens a new entry in |zipFile|. With |raw| set, the data written must already be
+// a raw deflate stream and the entry is closed with zipCloseFileInZipRaw().
+bool ZipOpenNewFileInZip(zipFile zipFile, const std::string& strPath, const OPTIONS& options,
+    const struct tm* lastModifiedTime, bool raw = false);
 
 } // namespace LIBZIP
 } // namespace AppExecFwk
@@ -26,6 +26,7 @@
 
 #include "contrib/minizip/unzip.h"
 #include "file_path.h"
+#include "zip_entry_index_cache.h"
 #include "zip_utils.h"
 
 namespace OHOS {
@@ -60,6 +61,8 @@ public:
 
     using ProgressCallback = std::function<void(int64_t)>;
 
+    using EntryIndex = ZipEntryIndex;
+
     // This class represents information of an entry (file or directory) in
     // a zip file.
     class EntryInfo {
@@ -127,6 +130,11 @@ public:
     // success.
     bool Open(FilePath& zipFilePath);
 
+    // Opens |zipFilePath| like Open() and indexes its entries by name. The
+    // index is cached, so opening the same unchanged file again skips the
+    // central directory walk.
+    bool OpenIndexed(FilePath& zipFilePath);
+
     // Opens the zip file referred to by the platform file |zipFd|, without
     // taking ownership of |zipFd|. Returns true on success.
     bool OpenFromPlatformFile(PlatformFile zipFd);
@@ -147,6 +155,20 @@ public:
     // Advances the next entry. Returns true on success.
     bool AdvanceToNextEntry();
 
+    // Gets the position of the current entry in the central directory. It can
+    // be passed to SeekToEntry() of any reader opened on the same zip file.
+    bool GetCurrentEntryPosition(unz_file_pos& position) const;
+
+    // Moves to the entry at |position| without walking the entries before it.
+    bool SeekToEntry(const unz_file_pos& position);
+
+    // Indexes the entries of the opened zip file by name. Returns true on success.
+    bool BuildEntryIndex();
+
+    // Moves to the entry named |name| and opens it like OpenCurrentEntryInZip().
+    // Uses the entry index when there is one, otherwise scans the entries.
+    bool LocateAndOpenEntry(const std::string& name);
+
     // Opens the current entry in the zip file. On success, returns true and
     // updates the the current entry state (i.e. CurrentEntryInfo() is
     // updated). This function should be called before operations over the
@@ -158,8 +180,9 @@ public:
 
     // Extracts |numBytesToExtract| bytes of the current entry to |delegate|,
     // starting from the beginning of the entry. Return value specifies whether
-    // the entire file was extracted.
-    bool ExtractCurrentEntry(WriterDelegate* delegate, uint64_t numBytesToExtract) const;
+    // the entire file was extracted. |bufferSize| bytes are inflated per write.
+    bool ExtractCurrentEntry(
+        WriterDelegate* delegate, uint64_t numBytesToExtract, int bufferSize = kDefaultZipBufSize) const;
 
     // Returns the current entry info. Returns NULL if the current entry is
     // not yet opened. OpenCurrentEntryInZip() must be called beforehand.
@@ -186,6 +209,7 @@ private:
     int numEntries_;
     bool reachedEnd_;
     std::unique_ptr<EntryInfo> currentEntryInfo_;
+    std::shared_ptr<const EntryIndex> entryIndex_;
 
     DISALLOW_COPY_AND_ASSIGN(ZipReader);
 };
@@ -83,6 +83,15 @@ using COMPRESS_STRATEGY = enum CompressStrategy;
 enum MemoryLevel { MEM_LEVEL_MIN_MEMLEVEL = 1, MEM_LEVEL_DEFAULT_MEMLEVEL = 8, MEM_LEVEL_MAX_MEMLEVEL = 9 };
 using MEMORY_LEVEL = enum MemoryLevel;
 
+// Bytes read from or written to a file per call. Flash storage reaches its full
+// throughput only with requests well above the 4 KB page size.
+constexpr int kDefaultZipBufSize = 256 * 1024;
+constexpr int kMinZipBufSize = 4 * 1024;
+constexpr int kMaxZipBufSize = 4 * 1024 * 1024;
+
+// Upper bound of the worker threads used for one zip or unzip call.
+constexpr int kMaxZipParallel = 16;
+
 // Compression Options
 struct Options {
     FLUSH_TYPE flush;
@@ -93,6 +102,9 @@ struct Options {
                            // compression rate, and 0 does not compress
     MEMORY_LEVEL memLevel; // Internal compression status, how much memory should be allocated
     COMPRESS_STRATEGY strategy; // CompressStrategy
+    int parallel;               // Threads compressing or extracting zip entries at once, 1 handles them in turn,
+                                // at most GetMaxZipParallel()
+    int bufferSize;             // File I/O buffer size, kMinZipBufSize to kMaxZipBufSize
 
     // default constructor
     Options()
@@ -109,6 +121,8 @@ struct Options {
         level = COMPRESS_LEVEL_DEFAULT_COMPRESSION;
         memLevel = MEM_LEVEL_DEFAULT_MEMLEVEL;
         strategy = COMPRESS_STRATEGY_DEFAULT_STRATEGY;
+        parallel = 1;
+        bufferSize = kDefaultZipBufSize;
     }
 };
 using OPTIONS = struct Options;
@@ -119,6 +133,8 @@ struct tm* GetCurrentSystemTime(void);
 bool StartsWith(const std::string& str, const std::string& searchFor);
 bool EndsWith(const std::string& str, const std::string& searchFor);
 bool FilePathCheckValid(const std::string& str);
+// The core count capped at kMaxZipParallel, never less than 1.
+int GetMaxZipParallel(void);
 void PostTask(const OHOS::AppExecFwk::InnerEvent::Callback& callback);
 } // namespace LIBZIP
 } // namespace AppExecFwk
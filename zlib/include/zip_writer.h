@@ -56,6 +56,14 @@ private:
     // there was no error writing entries.
     bool FlushEntriesIfNeeded(bool force, const OPTIONS& options);
 
+    // Writes the file or directory entry at |absolutePath| as |relativePath|.
+    bool WriteEntry(FilePath& relativePath, FilePath& absolutePath, const OPTIONS& options);
+
+    // Writes a batch of entries whose files are deflated by |options.parallel|
+    // worker threads and appended here in order as raw entries.
+    bool WriteEntriesInParallel(
+        std::vector<FilePath>& relativePaths, std::vector<FilePath>& absolutePaths, const OPTIONS& options);
+
     // Adds the files at |paths| to the ZIP file. These FilePaths must be relative
     // to |rootDir| specified in the Create method.
     bool AddEntries(const std::vector<FilePath>& paths, const OPTIONS& options);
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_STANDARD_TOOLS_ZLIB_STREAM_H
+#define FOUNDATION_APPEXECFWK_STANDARD_TOOLS_ZLIB_STREAM_H
+
+#include <memory>
+#include <stddef.h>
+#include <string>
+
+#include "zip_utils.h"
+#include "zlib.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace LIBZIP {
+
+// Framing of the compressed data.
+enum StreamFormat { STREAM_FORMAT_RAW = 0, STREAM_FORMAT_ZLIB = 1, STREAM_FORMAT_GZIP = 2 };
+
+// Compresses or decompresses data chunk by chunk in memory. The z_stream and
+// its scratch buffer come from a process-wide pool and go back to it when the
+// stream is destroyed, so short-lived streams do not pay for zlib's window
+// allocation each time.
+class ZlibStream {
+public:
+    // Returns nullptr if |format| or |options| are not accepted by zlib.
+    static std::unique_ptr<ZlibStream> CreateDeflate(StreamFormat format, const OPTIONS& options);
+    static std::unique_ptr<ZlibStream> CreateInflate(StreamFormat format);
+
+    ~ZlibStream();
+
+    // Feeds |size| bytes and appends whatever output zlib produces to |out|.
+    bool Push(const char* data, size_t size, std::string& out);
+
+    // Appends all output for the data pushed so far, ending on a byte boundary.
+    bool Flush(std::string& out);
+
+    // Ends the stream. For a decompressor it fails if the data was truncated.
+    bool Finish(std::string& out);
+
+    // Returns true once the end of the compressed stream has been seen.
+    bool IsFinished() const
+    {
+        return finished_;
+    }
+
+    struct PooledStream;
+
+private:
+    ZlibStream(bool deflate, std::unique_ptr<PooledStream> stream);
+
+    bool Process(const char* data, size_t size, int flush, std::string& out);
+
+    bool deflate_;
+    bool finished_ = false;
+    bool failed_ = false;
+    std::unique_ptr<PooledStream> stream_;
+
+    DISALLOW_COPY_AND_ASSIGN(ZlibStream);
+};
+} // namespace LIBZIP
+} // namespace AppExecFwk
+} // namespace OHOS
+
+#endif // FOUNDATION_APPEXECFWK_STANDARD_TOOLS_ZLIB_STREAM_H
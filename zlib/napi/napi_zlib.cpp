@@ -15,6 +15,7 @@
 
 #include "napi_zlib.h"
 
+#include <algorithm>
 #include <cstring>
 #include <uv.h>
 #include <vector>
@@ -28,9 +29,11 @@
 #include "napi_arg.h"
 #include "napi_constants.h"
 #include "napi_zlib_common.h"
+#include "securec.h"
 #include "zip.h"
 #include "zip_utils.h"
 #include "zlib_callback_info.h"
+#include "zlib_stream.h"
 
 using namespace OHOS::AppExecFwk;
 
@@ -42,6 +45,7 @@ constexpr size_t ARGS_MAX_COUNT = 10;
 constexpr int32_t PARAM3 = 3;
 constexpr int32_t PARAM2 = 2;
 const char* WRONG_PARAM = "wrong param type";
+const char* STREAM_DATA_ERROR = "stream data is damaged or the stream has ended";
 } // namespace
 
 #define COMPRESS_LEVE_CHECK(level, ret)                                                            \
@@ -196,6 +200,30 @@ napi_value MemLevelInit(napi_env env, napi_value exports)
 
     return exports;
 }
+/**
+ * @brief StreamFormat data initialization.
+ *
+ * @param env The environment that the Node-API call is invoked under.
+ * @param exports An empty object via the exports parameter as a convenience.
+ *
+ * @return The return value from Init is treated as the exports object for the module.
+ */
+napi_value StreamFormatInit(napi_env env, napi_value exports)
+{
+    LOGD("called.");
+    napi_value streamFormat = nullptr;
+    napi_create_object(env, &streamFormat);
+    SetNamedProperty(env, streamFormat, "STREAM_FORMAT_RAW", STREAM_FORMAT_RAW);
+    SetNamedProperty(env, streamFormat, "STREAM_FORMAT_ZLIB", STREAM_FORMAT_ZLIB);
+    SetNamedProperty(env, streamFormat, "STREAM_FORMAT_GZIP", STREAM_FORMAT_GZIP);
+
+    napi_property_descriptor properties[] = {
+        DECLARE_NAPI_PROPERTY("StreamFormat", streamFormat),
+    };
+    NAPI_CALL(env, napi_define_properties(env, exports, sizeof(properties) / sizeof(properties[0]), properties));
+
+    return exports;
+}
 /**
  * @brief FeatureAbility NAPI module registration.
  *
@@ -211,6 +239,8 @@ napi_value ZlibInit(napi_env env, napi_value exports)
     napi_property_descriptor properties[] = {
         DECLARE_NAPI_FUNCTION("compressFile", CompressFile),
         DECLARE_NAPI_FUNCTION("decompressFile", DecompressFile),
+        DECLARE_NAPI_FUNCTION("createDeflateStream", CreateDeflateStream),
+        DECLARE_NAPI_FUNCTION("createInflateStream", CreateInflateStream),
     };
 
     NAPI_CALL(env, napi_define_properties(env, exports, sizeof(properties) / sizeof(properties[0]), properties));
@@ -330,6 +360,23 @@ bool UnwrapOptionsParams(OPTIONS& options, napi_env env, napi_value arg)
                 COMPRESS_STRATEGY_CHECK(ret, false)
                 options.strategy = static_cast<COMPRESS_STRATEGY>(ret);
             }
+        } else if (strProName == std::string("parallel")) {
+            if (UnwrapIntValue(env, jsProValue, ret)) {
+                if (ret < 0) {
+                    LOGE("parallel parameter =[%{public}d] value is incorrect", ret);
+                    return false;
+                }
+                // 0 lets every core compress or extract entries, larger values are capped at the core count.
+                options.parallel = (ret > 0) ? std::min(ret, GetMaxZipParallel()) : GetMaxZipParallel();
+            }
+        } else if (strProName == std::string("bufferSize")) {
+            if (UnwrapIntValue(env, jsProValue, ret)) {
+                if (ret < kMinZipBufSize || ret > kMaxZipBufSize) {
+                    LOGE("bufferSize parameter =[%{public}d] value is incorrect", ret);
+                    return false;
+                }
+                options.bufferSize = ret;
+            }
         }
     }
     return true;
@@ -486,6 +533,157 @@ napi_value DecompressFile(napi_env env, napi_callback_info info)
     return promise;
 }
 
+bool UnwrapStreamFormat(napi_env env, napi_value arg, StreamFormat& format)
+{
+    if (IsTypeForNapiValue(env, arg, napi_undefined)) {
+        return true;
+    }
+    int ret = 0;
+    if (!UnwrapIntValue(env, arg, ret) || ret < STREAM_FORMAT_RAW || ret > STREAM_FORMAT_GZIP) {
+        LOGE("format parameter is incorrect");
+        return false;
+    }
+    format = static_cast<StreamFormat>(ret);
+    return true;
+}
+
+napi_value CreateOutputBuffer(napi_env env, const std::string& out)
+{
+    void* data = nullptr;
+    napi_value result = nullptr;
+    NAPI_CALL(env, napi_create_arraybuffer(env, out.size(), &data, &result));
+    if (!out.empty() && memcpy_s(data, out.size(), out.data(), out.size()) != EOK) {
+        LOGE("copy stream output failed");
+        return nullptr;
+    }
+    return result;
+}
+
+// Gets the native stream behind |this|, nullptr once finish() has returned it to the pool.
+ZlibStream* UnwrapStream(napi_env env, napi_callback_info info, napi_value& thisArg, napi_value* argv, size_t& argc)
+{
+    NAPI_CALL_BASE(env, napi_get_cb_info(env, info, &argc, argv, &thisArg, nullptr), nullptr);
+    ZlibStream* stream = nullptr;
+    if (napi_unwrap(env, thisArg, reinterpret_cast<void**>(&stream)) != napi_ok) {
+        return nullptr;
+    }
+    return stream;
+}
+
+napi_value StreamPush(napi_env env, napi_callback_info info)
+{
+    size_t argc = ARGS_SIZE_ONE;
+    napi_value argv[ARGS_SIZE_ONE] = { nullptr };
+    napi_value thisArg = nullptr;
+    ZlibStream* stream = UnwrapStream(env, info, thisArg, argv, argc);
+    void* data = nullptr;
+    size_t size = 0;
+    if (argc < ARGS_SIZE_ONE || napi_get_arraybuffer_info(env, argv[ARGS_POS_ZERO], &data, &size) != napi_ok) {
+        BusinessError::ThrowError(env, ERROR_PARAM_CHECK_ERROR, WRONG_PARAM);
+        return nullptr;
+    }
+    std::string out;
+    if (stream == nullptr || !stream->Push(static_cast<const char*>(data), size, out)) {
+        BusinessError::ThrowError(env, ERR_ZLIB_SRC_FILE_FORMAT_ERROR_OR_DAMAGED, STREAM_DATA_ERROR);
+        return nullptr;
+    }
+    return CreateOutputBuffer(env, out);
+}
+
+napi_value StreamFlush(napi_env env, napi_callback_info info)
+{
+    size_t argc = ARGS_SIZE_ZERO;
+    napi_value thisArg = nullptr;
+    ZlibStream* stream = UnwrapStream(env, info, thisArg, nullptr, argc);
+    std::string out;
+    if (stream == nullptr || !stream->Flush(out)) {
+        BusinessError::ThrowError(env, ERR_ZLIB_SRC_FILE_FORMAT_ERROR_OR_DAMAGED, STREAM_DATA_ERROR);
+        return nullptr;
+    }
+    return CreateOutputBuffer(env, out);
+}
+
+napi_value StreamFinish(napi_env env, napi_callback_info info)
+{
+    size_t argc = ARGS_SIZE_ZERO;
+    napi_value thisArg = nullptr;
+    ZlibStream* stream = UnwrapStream(env, info, thisArg, nullptr, argc);
+    std::string out;
+    bool finished = stream != nullptr && stream->Finish(out);
+    if (stream != nullptr) {
+        // Hand the z_stream back to the pool now instead of when the object is collected.
+        void* removed = nullptr;
+        napi_remove_wrap(env, thisArg, &removed);
+        delete stream;
+    }
+    if (!finished) {
+        BusinessError::ThrowError(env, ERR_ZLIB_SRC_FILE_FORMAT_ERROR_OR_DAMAGED, STREAM_DATA_ERROR);
+        return nullptr;
+    }
+    return CreateOutputBuffer(env, out);
+}
+
+napi_value WrapStream(napi_env env, std::unique_ptr<ZlibStream> stream)
+{
+    napi_value result = nullptr;
+    NAPI_CALL(env, napi_create_object(env, &result));
+    napi_property_descriptor properties[] = {
+        DECLARE_NAPI_FUNCTION("push", StreamPush),
+        DECLARE_NAPI_FUNCTION("flush", StreamFlush),
+        DECLARE_NAPI_FUNCTION("finish", StreamFinish),
+    };
+    NAPI_CALL(env, napi_define_properties(env, result, sizeof(properties) / sizeof(properties[0]), properties));
+    NAPI_CALL(env, napi_wrap(env, result, stream.get(),
+        [](napi_env env, void* data, void* hint) { delete static_cast<ZlibStream*>(data); }, nullptr, nullptr));
+    stream.release();
+    return result;
+}
+
+napi_value CreateDeflateStream(napi_env env, napi_callback_info info)
+{
+    LOGD("napi begin CreateDeflateStream");
+    NapiArg args(env, info);
+    if (!args.Init(ARGS_SIZE_ZERO, ARGS_SIZE_TWO)) {
+        BusinessError::ThrowError(env, ERROR_PARAM_CHECK_ERROR, WRONG_PARAM);
+        return nullptr;
+    }
+    StreamFormat format = STREAM_FORMAT_ZLIB;
+    OPTIONS options;
+    if ((args.GetArgc() > ARGS_POS_ZERO && !UnwrapStreamFormat(env, args[ARGS_POS_ZERO], format)) ||
+        (args.GetArgc() > ARGS_POS_ONE && !IsTypeForNapiValue(env, args[ARGS_POS_ONE], napi_undefined) &&
+            !UnwrapOptionsParams(options, env, args[ARGS_POS_ONE]))) {
+        BusinessError::ThrowError(env, ERROR_PARAM_CHECK_ERROR, WRONG_PARAM);
+        return nullptr;
+    }
+    auto stream = ZlibStream::CreateDeflate(format, options);
+    if (stream == nullptr) {
+        BusinessError::ThrowError(env, ERROR_PARAM_CHECK_ERROR, WRONG_PARAM);
+        return nullptr;
+    }
+    return WrapStream(env, std::move(stream));
+}
+
+napi_value CreateInflateStream(napi_env env, napi_callback_info info)
+{
+    LOGD("napi begin CreateInflateStream");
+    NapiArg args(env, info);
+    if (!args.Init(ARGS_SIZE_ZERO, ARGS_SIZE_ONE)) {
+        BusinessError::ThrowError(env, ERROR_PARAM_CHECK_ERROR, WRONG_PARAM);
+        return nullptr;
+    }
+    StreamFormat format = STREAM_FORMAT_ZLIB;
+    if (args.GetArgc() > ARGS_POS_ZERO && !UnwrapStreamFormat(env, args[ARGS_POS_ZERO], format)) {
+        BusinessError::ThrowError(env, ERROR_PARAM_CHECK_ERROR, WRONG_PARAM);
+        return nullptr;
+    }
+    auto stream = ZlibStream::CreateInflate(format);
+    if (stream == nullptr) {
+        BusinessError::ThrowError(env, ERROR_PARAM_CHECK_ERROR, WRONG_PARAM);
+        return nullptr;
+    }
+    return WrapStream(env, std::move(stream));
+}
+
 } // namespace LIBZIP
 } // namespace AppExecFwk
 } // namespace OHOS
\ No newline at end of file
@@ -65,6 +65,16 @@ napi_value CompressStrategyInit(napi_env env, napi_value exports);
  */
 napi_value MemLevelInit(napi_env env, napi_value exports);
 
+/**
+ * @brief StreamFormat data initialization.
+ *
+ * @param env The environment that the Node-API call is invoked under.
+ * @param exports An empty object via the exports parameter as a convenience.
+ *
+ * @return The return value from Init is treated as the exports object for the module.
+ */
+napi_value StreamFormatInit(napi_env env, napi_value exports);
+
 /**
  * @brief zlib NAPI module registration.
  *
@@ -79,6 +89,8 @@ bool InitParam(CallZipUnzipParam& param, napi_env env, NapiArg& args, bool isZip
 
 napi_value CompressFile(napi_env env, napi_callback_info info);
 napi_value DecompressFile(napi_env env, napi_callback_info info);
+napi_value CreateDeflateStream(napi_env env, napi_callback_info info);
+napi_value CreateInflateStream(napi_env env, napi_callback_info info);
 
 } // namespace LIBZIP
 } // namespace AppExecFwk
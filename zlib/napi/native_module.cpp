@@ -36,6 +36,7 @@ static napi_value Init(napi_env env, napi_value exports)
     CompressLevelInit(env, exports);
     CompressStrategyInit(env, exports);
     MemLevelInit(env, exports);
+    StreamFormatInit(env, exports);
     ZlibInit(env, exports);
 
     LOGD("init zip js app control success.");
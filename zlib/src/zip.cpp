@@ -15,11 +15,15 @@
 
 #include "zip.h"
 
+#include <algorithm>
+#include <atomic>
 #include <fcntl.h>
 #include <list>
 #include <stdio.h>
 #include <string>
+#include <thread>
 #include <unistd.h>
+#include <unordered_map>
 #include <vector>
 
 #include "appexecfwk_errors.h"
@@ -49,6 +53,16 @@ const std::string ZIP = ".zip";
 struct UnzipParam {
     FilterCallback filterCB = nullptr;
     bool logSkippedFiles = false;
+    int bufferSize = kDefaultZipBufSize;
+    // Receives the result of every file entry that was attempted, when set.
+    std::vector<UnzipEntryResult>* entryResults = nullptr;
+};
+
+// A file entry handed to the unzip workers, with the result of its extraction.
+struct UnzipEntry {
+    unz_file_pos position = {};
+    FilePath path;
+    ErrCode result = ERR_OK;
 };
 bool IsHiddenFile(const FilePath& filePath)
 {
@@ -203,7 +217,13 @@ ErrCode UnzipWithFilterAndWriters(const PlatformFile& srcFile, FilePath& destDir
 
             } else {
                 std::unique_ptr<WriterDelegate> writer = writerFactory(destDir, entryPath);
-                if (!reader.ExtractCurrentEntry(writer.get(), std::numeric_limits<uint64_t>::max())) {
+                bool extracted = reader.ExtractCurrentEntry(
+                    writer.get(), std::numeric_limits<uint64_t>::max(), unzipParam.bufferSize);
+                if (unzipParam.entryResults != nullptr) {
+                    unzipParam.entryResults->push_back(
+                        UnzipEntryResult { entryPath, extracted ? ERR_OK : ERR_ZLIB_SERVICE_DISABLED });
+                }
+                if (!extracted) {
                     LOGI("Failed to extract.");
                     return ERR_ZLIB_SERVICE_DISABLED;
                 }
@@ -220,6 +240,119 @@ ErrCode UnzipWithFilterAndWriters(const PlatformFile& srcFile, FilePath& destDir
     return ERR_OK;
 }
 
+// Walks the central directory once. Directories are created here in archive order,
+// the file entries to extract are collected into |entries|. A path that occurs more than
+// once keeps only its last entry, as in the serial path where the last write wins; two
+// workers must never write the same file.
+ErrCode ListEntriesToExtract(ZipReader& reader, FilePath& destDir, DirectoryCreator directoryCreator,
+    UnzipParam& unzipParam, std::vector<UnzipEntry>& entries)
+{
+    std::unordered_map<std::string, size_t> entryIndexes;
+    while (reader.HasMore()) {
+        if (!reader.OpenCurrentEntryInZip()) {
+            LOGI("Failed to open the current file in zip.");
+            return ERR_ZLIB_SERVICE_DISABLED;
+        }
+        FilePath entryPath = reader.CurrentEntryInfo()->GetFilePath();
+        if (reader.CurrentEntryInfo()->IsUnsafe()) {
+            LOGI("Found an unsafe file in zip.");
+            return ERR_ZLIB_SERVICE_DISABLED;
+        }
+        if (!unzipParam.filterCB(entryPath)) {
+            if (unzipParam.logSkippedFiles) {
+                LOGI("Skipped file.");
+            }
+        } else if (reader.CurrentEntryInfo()->IsDirectory()) {
+            if (!directoryCreator(destDir, entryPath)) {
+                LOGI("!!!directory_creator(%{private}s) Failed!!!.", entryPath.Value().c_str());
+                return ERR_ZLIB_DEST_FILE_DISABLED;
+            }
+        } else {
+            UnzipEntry entry;
+            entry.path = entryPath;
+            if (!reader.GetCurrentEntryPosition(entry.position)) {
+                return ERR_ZLIB_SERVICE_DISABLED;
+            }
+            auto inserted = entryIndexes.emplace(entryPath.Value(), entries.size());
+            if (inserted.second) {
+                entries.push_back(entry);
+            } else {
+                entries[inserted.first->second].position = entry.position;
+            }
+        }
+        if (!reader.AdvanceToNextEntry()) {
+            LOGI("Failed to advance to the next file.");
+            return ERR_ZLIB_SERVICE_DISABLED;
+        }
+    }
+    return ERR_OK;
+}
+
+// Each worker opens the zip file by path: readers on duplicated fds would share one file offset.
+void ExtractEntries(const FilePath& srcFile, FilePath destDir, WriterFactory writerFactory,
+    std::vector<UnzipEntry>& entries, std::atomic<size_t>& next, int bufferSize)
+{
+    ZipReader reader;
+    FilePath src = srcFile;
+    bool opened = reader.Open(src);
+    for (size_t i = next++; i < entries.size(); i = next++) {
+        UnzipEntry& entry = entries[i];
+        if (!opened) {
+            entry.result = ERR_ZLIB_SRC_FILE_FORMAT_ERROR;
+            continue;
+        }
+        if (!reader.SeekToEntry(entry.position)) {
+            entry.result = ERR_ZLIB_SERVICE_DISABLED;
+            continue;
+        }
+        std::unique_ptr<WriterDelegate> writer = writerFactory(destDir, entry.path);
+        if (!reader.ExtractCurrentEntry(writer.get(), std::numeric_limits<uint64_t>::max(), bufferSize)) {
+            entry.result = ERR_ZLIB_SERVICE_DISABLED;
+        }
+    }
+}
+
+ErrCode UnzipInParallel(const FilePath& srcFile, const PlatformFile& srcFd, FilePath& destDir,
+    WriterFactory writerFactory, DirectoryCreator directoryCreator, UnzipParam& unzipParam, int parallel)
+{
+    std::vector<UnzipEntry> entries;
+    {
+        ZipReader reader;
+        if (!reader.OpenFromPlatformFile(srcFd)) {
+            LOGI("Failed to open srcFile.");
+            return ERR_ZLIB_SRC_FILE_FORMAT_ERROR;
+        }
+        ErrCode ret = ListEntriesToExtract(reader, destDir, directoryCreator, unzipParam, entries);
+        if (ret != ERR_OK) {
+            return ret;
+        }
+    }
+
+    std::atomic<size_t> next(0);
+    std::vector<std::thread> workers;
+    // Options built natively bypass the check of the NAPI layer, so the count is capped here as well.
+    size_t threadCount = std::min(static_cast<size_t>(std::min(parallel, GetMaxZipParallel())), entries.size());
+    for (size_t i = 0; i < threadCount; i++) {
+        workers.emplace_back(ExtractEntries, std::cref(srcFile), destDir, writerFactory, std::ref(entries),
+            std::ref(next), unzipParam.bufferSize);
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    // Every entry is attempted, the first failure in archive order is returned.
+    ErrCode ret = ERR_OK;
+    for (const auto& entry : entries) {
+        if (unzipParam.entryResults != nullptr) {
+            unzipParam.entryResults->push_back(UnzipEntryResult { entry.path, entry.result });
+        }
+        if (ret == ERR_OK) {
+            ret = entry.result;
+        }
+    }
+    return ret;
+}
+
 ErrCode UnzipWithFilterCallback(
     const FilePath& srcFile, const FilePath& destDir, const OPTIONS& options, UnzipParam& unzipParam)
 {
@@ -243,9 +376,16 @@ ErrCode UnzipWithFilterCallback(
         LOGI("Failed to open.");
         return ERR_ZLIB_SRC_FILE_DISABLED;
     }
-    ErrCode ret = UnzipWithFilterAndWriters(zipFd, dest,
-        std::bind(&CreateFilePathWriterDelegate, std::placeholders::_1, std::placeholders::_2),
-        std::bind(&CreateDirectory, std::placeholders::_1, std::placeholders::_2), unzipParam);
+    WriterFactory writerFactory =
+        std::bind(&CreateFilePathWriterDelegate, std::placeholders::_1, std::placeholders::_2);
+    DirectoryCreator directoryCreator = std::bind(&CreateDirectory, std::placeholders::_1, std::placeholders::_2);
+    unzipParam.bufferSize = options.bufferSize;
+    ErrCode ret = ERR_OK;
+    if (options.parallel > 1) {
+        ret = UnzipInParallel(src, zipFd, dest, writerFactory, directoryCreator, unzipParam, options.parallel);
+    } else {
+        ret = UnzipWithFilterAndWriters(zipFd, dest, writerFactory, directoryCreator, unzipParam);
+    }
     close(zipFd);
     return ret;
 }
@@ -284,8 +424,15 @@ bool Unzip(const std::string& srcFile, const std::string& destFile, OPTIONS opti
         return false;
     }
     auto innerTask = [srcFileDir, destDir, options, zlibCallbackInfo]() {
+        std::vector<UnzipEntryResult> entryResults;
         UnzipParam unzipParam { .filterCB = ExcludeNoFilesFilter, .logSkippedFiles = true };
+        unzipParam.entryResults = &entryResults;
         ErrCode err = UnzipWithFilterCallback(srcFileDir, destDir, options, unzipParam);
+        for (const auto& entry : entryResults) {
+            if (entry.result != ERR_OK) {
+                LOGE("Failed to extract %{private}s, error %{public}d.", entry.path.Value().c_str(), entry.result);
+            }
+        }
         if (zlibCallbackInfo != nullptr) {
             zlibCallbackInfo->OnZipUnZipFinish(err);
         }
@@ -294,6 +441,66 @@ bool Unzip(const std::string& srcFile, const std::string& destFile, OPTIONS opti
     return true;
 }
 
+ErrCode Unzip(const std::string& srcFile, const std::string& destFile, const OPTIONS& options,
+    std::vector<UnzipEntryResult>& entryResults)
+{
+    FilePath srcFileDir(srcFile);
+    FilePath destDir(destFile);
+    if (srcFileDir.Value().empty() || !FilePath::PathIsValid(srcFileDir)) {
+        LOGI("Unzip called fail, srcFile isn't Exist.");
+        return ERR_ZLIB_SRC_FILE_DISABLED;
+    }
+    if (destDir.Value().empty() || !FilePath::DirectoryExists(destDir) || !FilePath::PathIsValid(destDir)) {
+        LOGI("Unzip called fail, destDir isn't path.");
+        return ERR_ZLIB_DEST_FILE_DISABLED;
+    }
+    entryResults.clear();
+    UnzipParam unzipParam { .filterCB = ExcludeNoFilesFilter, .logSkippedFiles = true };
+    unzipParam.entryResults = &entryResults;
+    return UnzipWithFilterCallback(srcFileDir, destDir, options, unzipParam);
+}
+
+ErrCode UnzipSingleEntry(const std::string& srcFile, const std::string& entryName, const std::string& destFile,
+    const OPTIONS& options)
+{
+    FilePath srcFileDir(srcFile);
+    FilePath destDir(destFile);
+    if (srcFileDir.Value().empty() || !FilePath::PathIsValid(srcFileDir)) {
+        LOGI("UnzipSingleEntry called fail, srcFile isn't Exist.");
+        return ERR_ZLIB_SRC_FILE_DISABLED;
+    }
+    if (destDir.Value().empty() || !FilePath::DirectoryExists(destDir) || !FilePath::PathIsValid(destDir)) {
+        LOGI("UnzipSingleEntry called fail, destDir isn't path.");
+        return ERR_ZLIB_DEST_FILE_DISABLED;
+    }
+    // The entry index of the archive is cached, so picking entries one by one does not walk the
+    // central directory on every call.
+    ZipReader reader;
+    if (!reader.OpenIndexed(srcFileDir)) {
+        LOGI("Failed to open srcFile.");
+        return ERR_ZLIB_SRC_FILE_FORMAT_ERROR;
+    }
+    if (!reader.LocateAndOpenEntry(entryName)) {
+        LOGI("UnzipSingleEntry: the entry isn't in the zip.");
+        return ERR_ZLIB_SRC_FILE_DISABLED;
+    }
+    ZipReader::EntryInfo* entryInfo = reader.CurrentEntryInfo();
+    if (entryInfo->IsUnsafe()) {
+        LOGI("Found an unsafe file in zip.");
+        return ERR_ZLIB_SERVICE_DISABLED;
+    }
+    FilePath entryPath = entryInfo->GetFilePath();
+    if (entryInfo->IsDirectory()) {
+        return CreateDirectory(destDir, entryPath) ? ERR_OK : ERR_ZLIB_DEST_FILE_DISABLED;
+    }
+    std::unique_ptr<WriterDelegate> writer = CreateFilePathWriterDelegate(destDir, entryPath);
+    if (!reader.ExtractCurrentEntry(writer.get(), std::numeric_limits<uint64_t>::max(), options.bufferSize)) {
+        LOGI("Failed to extract.");
+        return ERR_ZLIB_SERVICE_DISABLED;
+    }
+    return ERR_OK;
+}
+
 ErrCode ZipWithFilterCallback(
     const FilePath& srcDir, const FilePath& destFile, const OPTIONS& options, FilterCallback filterCB)
 {
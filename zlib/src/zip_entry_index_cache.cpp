@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "zip_entry_index_cache.h"
+
+#include <utility>
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace LIBZIP {
+
+ZipEntryIndexCache::ZipEntryIndexCache(size_t capacity) : capacity_(capacity) {}
+
+ZipEntryIndexCache& ZipEntryIndexCache::GetInstance()
+{
+    static ZipEntryIndexCache instance(DEFAULT_CAPACITY);
+    return instance;
+}
+
+bool ZipEntryIndexCache::IsSameFile(const CachedEntryIndex& cached, const struct stat& fileStat)
+{
+    return cached.size == fileStat.st_size && cached.modified.tv_sec == fileStat.st_mtim.tv_sec &&
+           cached.modified.tv_nsec == fileStat.st_mtim.tv_nsec;
+}
+
+std::shared_ptr<const ZipEntryIndex> ZipEntryIndexCache::Find(const std::string& path, const struct stat& fileStat)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+        if (it->path != path) {
+            continue;
+        }
+        if (!IsSameFile(*it, fileStat)) {
+            entries_.erase(it);
+            return nullptr;
+        }
+        entries_.splice(entries_.begin(), entries_, it);
+        return it->index;
+    }
+    return nullptr;
+}
+
+void ZipEntryIndexCache::Insert(
+    const std::string& path, const struct stat& fileStat, std::shared_ptr<const ZipEntryIndex> index)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.remove_if([&path](const CachedEntryIndex& cached) { return cached.path == path; });
+    CachedEntryIndex cached;
+    cached.path = path;
+    cached.size = fileStat.st_size;
+    cached.modified = fileStat.st_mtim;
+    cached.index = std::move(index);
+    entries_.push_front(std::move(cached));
+    while (entries_.size() > capacity_) {
+        entries_.pop_back();
+    }
+}
+
+size_t ZipEntryIndexCache::Size()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+} // namespace LIBZIP
+} // namespace AppExecFwk
+} // namespace OHOS
@@ -266,8 +266,8 @@ zipFile OpenFdForZipping(PlatformFile zipFd, int appendFlag)
     return zipOpen2("fd", appendFlag, NULL, &zipFuncs);
 }
 
-bool ZipOpenNewFileInZip(
-    zipFile zipFile, const std::string& strPath, const OPTIONS& options, const struct tm* lastModifiedTime)
+bool ZipOpenNewFileInZip(zipFile zipFile, const std::string& strPath, const OPTIONS& options,
+    const struct tm* lastModifiedTime, bool raw)
 {
     const uLong LANGUAGE_ENCODING_FLAG = 0x1 << 11;
 
@@ -283,7 +283,7 @@ bool ZipOpenNewFileInZip(
                       NULL,                      // comment
                       Z_DEFLATED,                // method
                       (int)options.level,        // level:default Z_DEFAULT_COMPRESSION
-                      0,                         // raw
+                      raw ? 1 : 0,               // raw
                       -MAX_WBITS,                // windowBits
                       (int)options.memLevel,     // memLevel: default DEF_MEM_LEVEL
                       (int)options.strategy,     // strategy:default Z_DEFAULT_STRATEGY
@@ -16,6 +16,7 @@
 #include "zip_reader.h"
 
 #include <stdio.h>
+#include <sys/stat.h>
 #include <time.h>
 #include <unistd.h>
 #include <utility>
@@ -24,6 +25,7 @@
 #include "contrib/minizip/unzip.h"
 #include "log.h"
 #include "string_ex.h"
+#include "zip_entry_index_cache.h"
 #include "zip_internal.h"
 #include "zip_utils.h"
 
@@ -32,7 +34,6 @@ using namespace OHOS::AppExecFwk;
 namespace OHOS {
 namespace AppExecFwk {
 namespace LIBZIP {
-
 // The implementation assumes that file names in zip files
 // are encoded in UTF-8. This is true for zip files created by Zip()
 // function in zip.h, but not true for user-supplied random zip files.
@@ -90,6 +91,30 @@ bool ZipReader::Open(FilePath& zipFilePath)
     return OpenInternal();
 }
 
+bool ZipReader::OpenIndexed(FilePath& zipFilePath)
+{
+    // Stat before opening, a file replaced in between is then indexed again next time.
+    struct stat fileStat = {};
+    bool hasStat = stat(zipFilePath.Value().c_str(), &fileStat) == 0;
+    if (!Open(zipFilePath)) {
+        return false;
+    }
+    if (hasStat) {
+        entryIndex_ = ZipEntryIndexCache::GetInstance().Find(zipFilePath.Value(), fileStat);
+        if (entryIndex_ != nullptr) {
+            return true;
+        }
+    }
+    if (!BuildEntryIndex()) {
+        Close();
+        return false;
+    }
+    if (hasStat) {
+        ZipEntryIndexCache::GetInstance().Insert(zipFilePath.Value(), fileStat, entryIndex_);
+    }
+    return true;
+}
+
 bool ZipReader::OpenFromPlatformFile(PlatformFile zipFd)
 {
     if (zipFile_ != nullptr) {
@@ -154,6 +179,82 @@ bool ZipReader::AdvanceToNextEntry()
     return true;
 }
 
+bool ZipReader::GetCurrentEntryPosition(unz_file_pos& position) const
+{
+    if (zipFile_ == nullptr) {
+        return false;
+    }
+    return unzGetFilePos(zipFile_, &position) == UNZ_OK;
+}
+
+bool ZipReader::SeekToEntry(const unz_file_pos& position)
+{
+    if (zipFile_ == nullptr) {
+        return false;
+    }
+    unz_file_pos target = position;
+    if (unzGoToFilePos(zipFile_, &target) != UNZ_OK) {
+        return false;
+    }
+    reachedEnd_ = false;
+    currentEntryInfo_.reset();
+    return true;
+}
+
+bool ZipReader::BuildEntryIndex()
+{
+    if (zipFile_ == nullptr) {
+        return false;
+    }
+    auto index = std::make_shared<EntryIndex>();
+    index->reserve(numEntries_);
+    int result = unzGoToFirstFile(zipFile_);
+    while (result == UNZ_OK) {
+        unz_file_info64 rawFileInfo = {};
+        char rawFileNameInZip[kZipMaxPath] = {};
+        unz64_file_pos position = {};
+        if (unzGetCurrentFileInfo64(zipFile_, &rawFileInfo, rawFileNameInZip, sizeof(rawFileNameInZip) - 1,
+            NULL, 0, NULL, 0) != UNZ_OK || unzGetFilePos64(zipFile_, &position) != UNZ_OK) {
+            return false;
+        }
+        // Like unzLocateFile(), the first of several entries with one name wins.
+        index->emplace(std::string(rawFileNameInZip), position);
+        result = unzGoToNextFile(zipFile_);
+    }
+    if (result != UNZ_END_OF_LIST_OF_FILE) {
+        return false;
+    }
+    // Leave the iteration where OpenInternal() put it.
+    if (numEntries_ > 0 && unzGoToFirstFile(zipFile_) != UNZ_OK) {
+        return false;
+    }
+    currentEntryInfo_.reset();
+    entryIndex_ = std::move(index);
+    return true;
+}
+
+bool ZipReader::LocateAndOpenEntry(const std::string& name)
+{
+    if (zipFile_ == nullptr) {
+        return false;
+    }
+    if (entryIndex_ != nullptr) {
+        auto it = entryIndex_->find(name);
+        if (it == entryIndex_->end()) {
+            return false;
+        }
+        unz64_file_pos position = it->second;
+        if (unzGoToFilePos64(zipFile_, &position) != UNZ_OK) {
+            return false;
+        }
+    } else if (unzLocateFile(zipFile_, name.c_str(), 1) != UNZ_OK) {
+        return false;
+    }
+    reachedEnd_ = false;
+    currentEntryInfo_.reset();
+    return OpenCurrentEntryInZip();
+}
+
 bool ZipReader::OpenCurrentEntryInZip()
 {
     if (zipFile_ == nullptr) {
@@ -180,7 +281,7 @@ bool ZipReader::OpenCurrentEntryInZip()
     return true;
 }
 
-bool ZipReader::ExtractCurrentEntry(WriterDelegate* delegate, uint64_t numBytesToExtract) const
+bool ZipReader::ExtractCurrentEntry(WriterDelegate* delegate, uint64_t numBytesToExtract, int bufferSize) const
 {
     if ((zipFile_ == nullptr) || (delegate == nullptr)) {
         return false;
@@ -192,12 +293,17 @@ bool ZipReader::ExtractCurrentEntry(WriterDelegate* delegate, uint64_t numBytesT
     if (!delegate->PrepareOutput()) {
         return false;
     }
-    auto buf = std::make_unique<char[]>(kZipBufSize);
+    // Not value-initialized: every byte is read before it is used.
+    std::unique_ptr<char[]> buf(new (std::nothrow) char[bufferSize]);
+    if (buf == nullptr) {
+        unzCloseCurrentFile(zipFile_);
+        return false;
+    }
     uint64_t remainingCapacity = numBytesToExtract;
     bool entirefileextracted = false;
 
     while (remainingCapacity > 0) {
-        const int numBytesRead = unzReadCurrentFile(zipFile_, buf.get(), kZipBufSize);
+        const int numBytesRead = unzReadCurrentFile(zipFile_, buf.get(), bufferSize);
         if (numBytesRead == 0) {
             entirefileextracted = true;
             break;
@@ -252,6 +358,7 @@ void ZipReader::Reset()
     numEntries_ = 0;
     reachedEnd_ = false;
     currentEntryInfo_.reset();
+    entryIndex_.reset();
 }
 
 // FilePathWriterDelegate
@@ -15,7 +15,9 @@
 
 #include "zip_utils.h"
 
+#include <algorithm>
 #include <regex>
+#include <thread>
 
 #include "event_handler.h"
 
@@ -44,7 +46,9 @@ void PostTask(const InnerEvent::Callback& callback)
 struct tm* GetCurrentSystemTime(void)
 {
     auto tt = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
-    struct tm* time = localtime(&tt);
+    // Zip and unzip workers call this concurrently, so each thread gets its own result.
+    static thread_local struct tm localTime = {};
+    struct tm* time = localtime_r(&tt, &localTime);
     if (time == nullptr) {
         return nullptr;
     }
@@ -78,6 +82,13 @@ bool FilePathCheckValid(const std::string& str)
     return std::regex_match(str, FILE_PATH_REGEX);
 }
 
+int GetMaxZipParallel(void)
+{
+    // hardware_concurrency() returns 0 when the count is unknown.
+    int cores = static_cast<int>(std::thread::hardware_concurrency());
+    return std::min(std::max(cores, 1), kMaxZipParallel);
+}
+
 } // namespace LIBZIP
 } // namespace AppExecFwk
 } // namespace OHOS
\ No newline at end of file
@@ -15,13 +15,22 @@
 
 #include "zip_writer.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <fcntl.h>
 #include <mutex>
 #include <stdio.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
 
 #include "contrib/minizip/zip.h"
 #include "directory_ex.h"
 #include "log.h"
 #include "zip_internal.h"
+#include "zlib.h"
 
 using namespace OHOS::AppExecFwk;
 
@@ -31,14 +40,115 @@ namespace LIBZIP {
 namespace {
 // Numbers of pending entries that trigger writting them to the ZIP file.
 constexpr size_t g_MaxPendingEntriesCount = 50;
+// Enough to tell EOF apart from a file that grew since fstat(), without growing the content.
+constexpr size_t g_EofProbeSize = 512;
+// Larger files are deflated by the writing thread itself, so a batch holds little memory.
+constexpr off_t g_MaxParallelEntrySize = 2 * 1024 * 1024;
 const std::string SEPARATOR = "/";
 std::mutex g_mutex;
 ;
 
-bool AddFileContentToZip(zipFile zip_file, FilePath& file_path)
+// A file entry deflated off the writing thread, waiting to be appended in order.
+struct CompressedEntry {
+    bool parallel = false;
+    bool done = false;
+    bool success = false;
+    uLong crc = 0;
+    uLong size = 0;
+    std::string data;
+};
+
+bool IsParallelEntry(FilePath& absolutePath)
+{
+    if (!FilePath::PathIsValid(absolutePath) || FilePath::IsDir(absolutePath)) {
+        return false;
+    }
+    struct stat fileStat = {};
+    return stat(absolutePath.Value().c_str(), &fileStat) == 0 && fileStat.st_size <= g_MaxParallelEntrySize;
+}
+
+// Opens a file that is read once from start to end, so the kernel can read ahead aggressively.
+int OpenForSequentialRead(FilePath& file_path)
+{
+    int fd = open(file_path.Value().c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        LOGI("filePath to realPath failed! filePath:%{private}s ", file_path.Value().c_str());
+        return -1;
+    }
+    posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    return fd;
+}
+
+ssize_t ReadFileAt(int fd, char* buf, size_t size, off_t offset)
+{
+    ssize_t num_bytes = 0;
+    do {
+        num_bytes = pread(fd, buf, size, offset);
+    } while (num_bytes < 0 && errno == EINTR);
+    return num_bytes;
+}
+
+bool ReadFileContent(FilePath& file_path, std::string& content, const OPTIONS& options)
+{
+    int fd = OpenForSequentialRead(file_path);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat fileStat = {};
+    if (fstat(fd, &fileStat) == 0) {
+        content.resize(fileStat.st_size);
+    }
+    // Read straight into the content; past the fstat() size a small probe either confirms EOF
+    // or picks up what the file grew by.
+    size_t offset = 0;
+    ssize_t num_bytes = 0;
+    char probe[g_EofProbeSize];
+    do {
+        if (offset < content.size()) {
+            size_t size = std::min(content.size() - offset, static_cast<size_t>(options.bufferSize));
+            num_bytes = ReadFileAt(fd, &content[offset], size, offset);
+        } else {
+            num_bytes = ReadFileAt(fd, probe, sizeof(probe), offset);
+            if (num_bytes > 0) {
+                content.append(probe, num_bytes);
+            }
+        }
+        offset += num_bytes > 0 ? num_bytes : 0;
+    } while (num_bytes > 0);
+    content.resize(offset);
+    close(fd);
+    return num_bytes == 0;
+}
+
+// Deflates the whole file into a raw stream, as minizip would have written it.
+bool DeflateFileContent(FilePath& file_path, const OPTIONS& options, CompressedEntry& entry)
+{
+    std::string content;
+    if (!ReadFileContent(file_path, content, options)) {
+        return false;
+    }
+    entry.size = content.size();
+    entry.crc = crc32(crc32(0L, Z_NULL, 0), reinterpret_cast<const Bytef*>(content.data()), content.size());
+
+    z_stream stream = {};
+    if (deflateInit2(&stream, (int)options.level, Z_DEFLATED, -MAX_WBITS, (int)options.memLevel,
+        (int)options.strategy) != Z_OK) {
+        return false;
+    }
+    entry.data.resize(deflateBound(&stream, content.size()));
+    stream.next_in = reinterpret_cast<Bytef*>(content.data());
+    stream.avail_in = content.size();
+    stream.next_out = reinterpret_cast<Bytef*>(entry.data.data());
+    stream.avail_out = entry.data.size();
+    int ret = deflate(&stream, Z_FINISH);
+    entry.data.resize(stream.total_out);
+    deflateEnd(&stream);
+    return ret == Z_STREAM_END;
+}
+
+bool AddFileContentToZip(zipFile zip_file, FilePath& file_path, const OPTIONS& options)
 {
     LOGI("called");
-    char buf[kZipBufSize];
     if (!FilePathCheckValid(file_path.Value())) {
         LOGI("filePath is invalid!!! file_path=%{public}s", file_path.Value().c_str());
         return false;
@@ -48,28 +158,29 @@ bool AddFileContentToZip(zipFile zip_file, FilePath& file_path)
         return false;
     }
 
-    FILE* fp = fopen(file_path.Value().c_str(), "rb");
-    if (fp == nullptr) {
-        LOGI("filePath to realPath failed! filePath:%{private}s ", file_path.Value().c_str());
+    int fd = OpenForSequentialRead(file_path);
+    if (fd < 0) {
         return false;
     }
 
-    while (!feof(fp)) {
-        uint32_t num_bytes = fread(buf, 1, kZipBufSize, fp);
-        if (num_bytes > 0) {
-            if (zipWriteInFileInZip(zip_file, buf, num_bytes) != ZIP_OK) {
-                LOGI("Could not write data to zip for path:%{private}s ", file_path.Value().c_str());
-                fclose(fp);
-                fp = nullptr;
-                return false;
-            }
-        } else {
-            break;
+    // Not value-initialized: every byte is read before it is used.
+    std::unique_ptr<char[]> buf(new (std::nothrow) char[options.bufferSize]);
+    if (buf == nullptr) {
+        close(fd);
+        return false;
+    }
+    off_t offset = 0;
+    ssize_t num_bytes = 0;
+    while ((num_bytes = ReadFileAt(fd, buf.get(), options.bufferSize, offset)) > 0) {
+        if (zipWriteInFileInZip(zip_file, buf.get(), num_bytes) != ZIP_OK) {
+            LOGI("Could not write data to zip for path:%{private}s ", file_path.Value().c_str());
+            close(fd);
+            return false;
         }
+        offset += num_bytes;
     }
-    fclose(fp);
-    fp = nullptr;
-    return true;
+    close(fd);
+    return num_bytes == 0;
 }
 
 bool OpenNewFileEntry(
@@ -102,7 +213,7 @@ bool AddFileEntryToZip(zipFile zip_file, FilePath& relativePath, FilePath& absol
     if (!OpenNewFileEntry(zip_file, relativePath, false, lastModified, options)) {
         return false;
     }
-    bool success = AddFileContentToZip(zip_file, absolutePath);
+    bool success = AddFileContentToZip(zip_file, absolutePath, options);
     if (!CloseNewFileEntry(zip_file)) {
         LOGI("!!! CloseNewFileEntry returnValule is false !!!");
         return false;
@@ -110,6 +221,24 @@ bool AddFileEntryToZip(zipFile zip_file, FilePath& relativePath, FilePath& absol
     return success;
 }
 
+bool AddCompressedEntryToZip(
+    zipFile zip_file, FilePath& relativePath, const CompressedEntry& entry, const OPTIONS& options)
+{
+    struct tm* lastModified = GetCurrentSystemTime();
+    if (lastModified == nullptr) {
+        return false;
+    }
+    if (!ZipOpenNewFileInZip(zip_file, relativePath.Value(), options, lastModified, true)) {
+        return false;
+    }
+    bool success = zipWriteInFileInZip(zip_file, entry.data.data(), entry.data.size()) == ZIP_OK;
+    if (zipCloseFileInZipRaw(zip_file, entry.size, entry.crc) != ZIP_OK) {
+        LOGI("!!! zipCloseFileInZipRaw returnValule is false !!!");
+        return false;
+    }
+    return success;
+}
+
 bool AddDirectoryEntryToZip(zipFile zip_file, FilePath& path, struct tm* lastModified, const OPTIONS& options)
 {
     LOGI("called");
@@ -200,28 +329,98 @@ bool ZipWriter::FlushEntriesIfNeeded(bool force, const OPTIONS& options)
             }
         }
         pendingEntries_.erase(pendingEntries_.begin(), pendingEntries_.begin() + entry_count);
+        if (options.parallel > 1) {
+            if (!WriteEntriesInParallel(relativePaths, absolutePaths, options)) {
+                return false;
+            }
+            continue;
+        }
         for (size_t i = 0; i < absolutePaths.size(); i++) {
-            FilePath& relativePath = relativePaths[i];
-            FilePath& absolutePath = absolutePaths[i];
-            bool isValid = FilePath::PathIsValid(absolutePath);
-            bool isDir = FilePath::IsDir(absolutePath);
-            if (isValid && !isDir) {
-                if (!AddFileEntryToZip(zipFile_, relativePath, absolutePath, options)) {
-                    LOGI("Failed to write file");
-                    return false;
-                }
-            } else {
-                // Missing file or directory case.
-                struct tm* last_modified = GetCurrentSystemTime();
-                if (!AddDirectoryEntryToZip(zipFile_, relativePath, last_modified, options)) {
-                    LOGI("Failed to write directory");
-                    return false;
-                }
+            if (!WriteEntry(relativePaths[i], absolutePaths[i], options)) {
+                return false;
             }
         }
     }
     return true;
 }
+
+bool ZipWriter::WriteEntry(FilePath& relativePath, FilePath& absolutePath, const OPTIONS& options)
+{
+    bool isValid = FilePath::PathIsValid(absolutePath);
+    bool isDir = FilePath::IsDir(absolutePath);
+    if (isValid && !isDir) {
+        if (!AddFileEntryToZip(zipFile_, relativePath, absolutePath, options)) {
+            LOGI("Failed to write file");
+            return false;
+        }
+    } else {
+        // Missing file or directory case.
+        struct tm* last_modified = GetCurrentSystemTime();
+        if (!AddDirectoryEntryToZip(zipFile_, relativePath, last_modified, options)) {
+            LOGI("Failed to write directory");
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ZipWriter::WriteEntriesInParallel(
+    std::vector<FilePath>& relativePaths, std::vector<FilePath>& absolutePaths, const OPTIONS& options)
+{
+    size_t count = absolutePaths.size();
+    std::vector<CompressedEntry> entries(count);
+    for (size_t i = 0; i < count; i++) {
+        entries[i].parallel = IsParallelEntry(absolutePaths[i]);
+        entries[i].done = !entries[i].parallel;
+    }
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::atomic<size_t> next(0);
+    std::atomic_bool cancel(false);
+    auto worker = [&]() {
+        for (size_t i = next++; i < count && !cancel.load(); i = next++) {
+            if (!entries[i].parallel) {
+                continue;
+            }
+            CompressedEntry entry;
+            entry.parallel = true;
+            entry.success = DeflateFileContent(absolutePaths[i], options, entry);
+            entry.done = true;
+            std::lock_guard<std::mutex> lock(mutex);
+            entries[i] = std::move(entry);
+            condition.notify_all();
+        }
+    };
+    std::vector<std::thread> workers;
+    size_t threadCount = std::min(static_cast<size_t>(std::min(options.parallel, GetMaxZipParallel())), count);
+    for (size_t i = 0; i < threadCount; i++) {
+        workers.emplace_back(worker);
+    }
+
+    // Entries are appended in their original order while later ones are still being deflated.
+    bool success = true;
+    for (size_t i = 0; i < count && success; i++) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.wait(lock, [&entries, i]() { return entries[i].done; });
+        }
+        if (!entries[i].parallel) {
+            success = WriteEntry(relativePaths[i], absolutePaths[i], options);
+            continue;
+        }
+        success = entries[i].success && AddCompressedEntryToZip(zipFile_, relativePaths[i], entries[i], options);
+        if (!success) {
+            LOGI("Failed to write file");
+        }
+        std::string().swap(entries[i].data);
+    }
+    cancel.store(true);
+    for (auto& thread : workers) {
+        thread.join();
+    }
+    return success;
+}
 } // namespace LIBZIP
 } // namespace AppExecFwk
 } // namespace OHOS
\ No newline at end of file
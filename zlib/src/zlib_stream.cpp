@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "zlib_stream.h"
+
+#include <algorithm>
+#include <climits>
+#include <mutex>
+#include <vector>
+
+#include "log.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace LIBZIP {
+namespace {
+// Idle streams kept for reuse, each holds zlib's window and hash tables.
+constexpr size_t g_MaxPooledStreams = 4;
+constexpr size_t g_StreamBufSize = 16 * 1024;
+constexpr int g_GzipWindowBitsOffset = 16;
+} // namespace
+
+struct ZlibStream::PooledStream {
+    bool deflate = false;
+    int windowBits = 0;
+    int level = 0;
+    int memLevel = 0;
+    int strategy = 0;
+    z_stream stream = {};
+    std::vector<Bytef> buffer;
+
+    bool Matches(const PooledStream& other) const
+    {
+        return deflate == other.deflate && windowBits == other.windowBits && level == other.level &&
+               memLevel == other.memLevel && strategy == other.strategy;
+    }
+
+    ~PooledStream();
+};
+
+namespace {
+std::mutex g_poolMutex;
+std::vector<std::unique_ptr<ZlibStream::PooledStream>> g_pool;
+} // namespace
+
+ZlibStream::PooledStream::~PooledStream()
+{
+    if (deflate) {
+        deflateEnd(&stream);
+    } else {
+        inflateEnd(&stream);
+    }
+}
+
+namespace {
+int GetWindowBits(StreamFormat format)
+{
+    switch (format) {
+        case STREAM_FORMAT_RAW:
+            return -MAX_WBITS;
+        case STREAM_FORMAT_ZLIB:
+            return MAX_WBITS;
+        case STREAM_FORMAT_GZIP:
+            return MAX_WBITS + g_GzipWindowBitsOffset;
+        default:
+            return 0;
+    }
+}
+
+// Takes an idle stream with the same parameters, or initializes a new one.
+std::unique_ptr<ZlibStream::PooledStream> AcquireStream(const ZlibStream::PooledStream& params)
+{
+    {
+        std::lock_guard<std::mutex> lock(g_poolMutex);
+        auto it = std::find_if(g_pool.begin(), g_pool.end(),
+            [&params](const std::unique_ptr<ZlibStream::PooledStream>& pooled) { return pooled->Matches(params); });
+        if (it != g_pool.end()) {
+            auto stream = std::move(*it);
+            g_pool.erase(it);
+            return stream;
+        }
+    }
+    auto stream = std::make_unique<ZlibStream::PooledStream>();
+    stream->deflate = params.deflate;
+    stream->windowBits = params.windowBits;
+    stream->level = params.level;
+    stream->memLevel = params.memLevel;
+    stream->strategy = params.strategy;
+    int ret = params.deflate ?
+        deflateInit2(&stream->stream, params.level, Z_DEFLATED, params.windowBits, params.memLevel, params.strategy) :
+        inflateInit2(&stream->stream, params.windowBits);
+    if (ret != Z_OK) {
+        LOGE("init zlib stream failed %{public}d", ret);
+        // Nothing was allocated, so the destructor must not end the stream.
+        stream->stream = {};
+        return nullptr;
+    }
+    stream->buffer.resize(g_StreamBufSize);
+    return stream;
+}
+
+void ReleaseStream(std::unique_ptr<ZlibStream::PooledStream> stream)
+{
+    int ret = stream->deflate ? deflateReset(&stream->stream) : inflateReset(&stream->stream);
+    if (ret != Z_OK) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(g_poolMutex);
+    if (g_pool.size() < g_MaxPooledStreams) {
+        g_pool.push_back(std::move(stream));
+    }
+}
+} // namespace
+
+std::unique_ptr<ZlibStream> ZlibStream::CreateDeflate(StreamFormat format, const OPTIONS& options)
+{
+    PooledStream params;
+    params.deflate = true;
+    params.windowBits = GetWindowBits(format);
+    params.level = (int)options.level;
+    params.memLevel = (int)options.memLevel;
+    params.strategy = (int)options.strategy;
+    if (params.windowBits == 0) {
+        return nullptr;
+    }
+    auto stream = AcquireStream(params);
+    if (stream == nullptr) {
+        return nullptr;
+    }
+    return std::unique_ptr<ZlibStream>(new ZlibStream(true, std::move(stream)));
+}
+
+std::unique_ptr<ZlibStream> ZlibStream::CreateInflate(StreamFormat format)
+{
+    PooledStream params;
+    params.windowBits = GetWindowBits(format);
+    if (params.windowBits == 0) {
+        return nullptr;
+    }
+    auto stream = AcquireStream(params);
+    if (stream == nullptr) {
+        return nullptr;
+    }
+    return std::unique_ptr<ZlibStream>(new ZlibStream(false, std::move(stream)));
+}
+
+ZlibStream::ZlibStream(bool deflate, std::unique_ptr<PooledStream> stream)
+    : deflate_(deflate), stream_(std::move(stream))
+{}
+
+ZlibStream::~ZlibStream()
+{
+    // A stream that hit an error may hold inconsistent state, it is not reused.
+    if (stream_ != nullptr && !failed_) {
+        ReleaseStream(std::move(stream_));
+    }
+}
+
+bool ZlibStream::Push(const char* data, size_t size, std::string& out)
+{
+    return Process(data, size, Z_NO_FLUSH, out);
+}
+
+bool ZlibStream::Flush(std::string& out)
+{
+    return Process(nullptr, 0, Z_SYNC_FLUSH, out);
+}
+
+bool ZlibStream::Finish(std::string& out)
+{
+    if (!Process(nullptr, 0, deflate_ ? Z_FINISH : Z_SYNC_FLUSH, out)) {
+        return false;
+    }
+    if (!finished_) {
+        LOGE("zlib stream ended before its end marker");
+        return false;
+    }
+    return true;
+}
+
+bool ZlibStream::Process(const char* data, size_t size, int flush, std::string& out)
+{
+    if (failed_) {
+        return false;
+    }
+    if (finished_) {
+        // Input after the end marker of a decompressed stream is ignored, like zlib's uncompress().
+        return true;
+    }
+    z_stream& stream = stream_->stream;
+    std::vector<Bytef>& buffer = stream_->buffer;
+    size_t offset = 0;
+    do {
+        // avail_in is 32 bits wide, larger chunks are fed in pieces.
+        size_t piece = std::min<size_t>(size - offset, UINT_MAX);
+        stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data)) + offset;
+        stream.avail_in = static_cast<uInt>(piece);
+        int pieceFlush = (offset + piece == size) ? flush : Z_NO_FLUSH;
+        do {
+            stream.next_out = buffer.data();
+            stream.avail_out = static_cast<uInt>(buffer.size());
+            int ret = deflate_ ? deflate(&stream, pieceFlush) : inflate(&stream, pieceFlush);
+            if (ret != Z_OK && ret != Z_STREAM_END && ret != Z_BUF_ERROR) {
+                LOGE("zlib stream failed %{public}d", ret);
+                failed_ = true;
+                return false;
+            }
+            out.append(reinterpret_cast<const char*>(buffer.data()), buffer.size() - stream.avail_out);
+            if (ret == Z_STREAM_END) {
+                finished_ = true;
+                return true;
+            }
+        } while (stream.avail_out == 0);
+        offset += piece;
+    } while (offset < size);
+    return true;
+}
+} // namespace LIBZIP
+} // namespace AppExecFwk
+} // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -13,29 +13,17 @@
  * limitations under the License.
  */
 
-#ifndef COMMUNICATIONNETSTACK_DISK_IOS_HANDLER_H
-#define COMMUNICATIONNETSTACK_DISK_IOS_HANDLER_H
+#ifndef PLUGINS_ZLIB_BENCHMARK_DIRECTORY_EX_H
+#define PLUGINS_ZLIB_BENCHMARK_DIRECTORY_EX_H
 
-#include <mutex>
 #include <string>
 
-namespace OHOS::NetStack::Http {
-class DiskHandler final {
-public:
-    DiskHandler() = delete;
-
-    explicit DiskHandler(std::string fileName);
-
-    void Write(const std::string &str);
-
-    void Delete();
-
-    [[nodiscard]] std::string Read();
-
-private:
-    std::mutex mutex_;
-
-    std::string fileName_;
-};
-} // namespace OHOS::NetStack::Http
-#endif /* COMMUNICATIONNETSTACK_DISK_IOS_HANDLER_H */
+// Host stand-in for the part of c_utils directory_ex.h the zip sources use.
+inline std::string IncludeTrailingPathDelimiter(const std::string& path)
+{
+    if (!path.empty() && path.back() == '/') {
+        return path;
+    }
+    return path + "/";
+}
+#endif // PLUGINS_ZLIB_BENCHMARK_DIRECTORY_EX_H
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PLUGINS_ZLIB_BENCHMARK_EVENT_HANDLER_H
+#define PLUGINS_ZLIB_BENCHMARK_EVENT_HANDLER_H
+
+#include <functional>
+#include <memory>
+#include <string>
+
+// Host stand-in for the ability runtime event handler. The benchmark drives
+// ZipWriter and ZipReader directly and never posts to the ZipThread, so
+// posted tasks simply run on the calling thread.
+namespace OHOS::AppExecFwk {
+struct InnerEvent {
+    using Callback = std::function<void()>;
+};
+
+class EventRunner {
+public:
+    static std::shared_ptr<EventRunner> Create(const std::string& name)
+    {
+        (void)name;
+        return std::make_shared<EventRunner>();
+    }
+};
+
+class EventHandler {
+public:
+    explicit EventHandler(const std::shared_ptr<EventRunner>& runner)
+    {
+        (void)runner;
+    }
+
+    bool PostTask(const InnerEvent::Callback& callback)
+    {
+        callback();
+        return true;
+    }
+};
+} // namespace OHOS::AppExecFwk
+#endif // PLUGINS_ZLIB_BENCHMARK_EVENT_HANDLER_H
@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PLUGINS_ZLIB_BENCHMARK_LOG_H
+#define PLUGINS_ZLIB_BENCHMARK_LOG_H
+
+// Host stand-in for the plugin log. Logging is dropped so it does not show up
+// in the measurements.
+#define LOGF(fmt, ...) ((void)0)
+#define LOGE(fmt, ...) ((void)0)
+#define LOGW(fmt, ...) ((void)0)
+#define LOGI(fmt, ...) ((void)0)
+#define LOGD(fmt, ...) ((void)0)
+
+#endif // PLUGINS_ZLIB_BENCHMARK_LOG_H
@@ -0,0 +1,64 @@
+#!/bin/bash
+# Copyright (c) 2026 Huawei Device Co., Ltd.
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# Builds zip_benchmark with the host compiler and runs it, without GN.
+#
+# Usage: ./run_benchmark.sh [--format=json|csv] [--min-time=<seconds>] [--files=<count>]
+#
+# Third-party sources are taken from the source tree next to plugins/ unless
+# overridden:
+#   SECUREC_DIR  bounds_checking_function checkout (include/, src/)
+#   ZLIB_DIR     zlib checkout with contrib/minizip
+#   CXX          host C++ compiler (default g++)
+#   OUT_DIR      build directory (default ${TMPDIR:-/tmp}/zip_benchmark)
+
+set -euo pipefail
+
+SCRIPT_DIR="$(cd "$(dirname "$0")" && pwd)"
+ZLIB_PLUGIN_DIR="$(cd "${SCRIPT_DIR}/../.." && pwd)"
+SOURCE_ROOT="$(dirname "$(dirname "${ZLIB_PLUGIN_DIR}")")"
+SECUREC_DIR="${SECUREC_DIR:-${SOURCE_ROOT}/third_party/bounds_checking_function}"
+ZLIB_DIR="${ZLIB_DIR:-${SOURCE_ROOT}/third_party/zlib}"
+CXX="${CXX:-g++}"
+OUT_DIR="${OUT_DIR:-${TMPDIR:-/tmp}/zip_benchmark}"
+
+mkdir -p "${OUT_DIR}"
+
+C_SOURCES=()
+for name in adler32 compress crc32 deflate infback inffast inflate inftrees trees uncompr zutil; do
+    C_SOURCES+=("${ZLIB_DIR}/${name}.c")
+done
+for name in ioapi unzip zip; do
+    C_SOURCES+=("${ZLIB_DIR}/contrib/minizip/${name}.c")
+done
+if [ -d "${SECUREC_DIR}/src" ]; then
+    C_SOURCES+=("${SECUREC_DIR}"/src/*.c)
+fi
+OBJECTS=()
+for src in "${C_SOURCES[@]}"; do
+    obj="${OUT_DIR}/$(basename "$(dirname "${src}")")_$(basename "${src}" .c).o"
+    cc -O2 -c -I"${ZLIB_DIR}" -I"${SECUREC_DIR}/include" "${src}" -o "${obj}"
+    OBJECTS+=("${obj}")
+done
+
+"${CXX}" -std=c++17 -O2 -pthread \
+    -I"${SCRIPT_DIR}/host_include" -I"${ZLIB_PLUGIN_DIR}/include" -I"${ZLIB_PLUGIN_DIR}/common" \
+    -I"${ZLIB_DIR}" -I"${SECUREC_DIR}/include" \
+    "${ZLIB_PLUGIN_DIR}/src/file_path.cpp" "${ZLIB_PLUGIN_DIR}/src/zip_entry_index_cache.cpp" \
+    "${ZLIB_PLUGIN_DIR}/src/zip_internal.cpp" "${ZLIB_PLUGIN_DIR}/src/zip_reader.cpp" \
+    "${ZLIB_PLUGIN_DIR}/src/zip_utils.cpp" "${ZLIB_PLUGIN_DIR}/src/zip_writer.cpp" \
+    "${SCRIPT_DIR}/zip_benchmark.cpp" \
+    "${OBJECTS[@]}" \
+    -o "${OUT_DIR}/zip_benchmark"
+
+"${OUT_DIR}/zip_benchmark" "$@"
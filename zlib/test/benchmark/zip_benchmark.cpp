@@ -0,0 +1,300 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+#include "file_path.h"
+#include "zip_reader.h"
+#include "zip_utils.h"
+#include "zip_writer.h"
+
+/*
+ * Throughput of the zip pipeline on generated files. The files are written
+ * once to a temporary directory, every case then runs the real ZipWriter or
+ * ZipReader until --min-time elapsed. MB/s is counted on the uncompressed
+ * bytes. The inputs stay in the page cache, so the cases measure CPU and
+ * syscall cost rather than the storage itself.
+ */
+namespace OHOS::AppExecFwk::LIBZIP {
+namespace {
+using Clock = std::chrono::steady_clock;
+
+constexpr double DEFAULT_MIN_SECONDS = 1.0;
+constexpr double BYTES_PER_MB = 1024.0 * 1024.0;
+
+// A tree of many small files, the shape parallel compression is meant for.
+constexpr size_t DEFAULT_FILE_COUNT = 2000;
+constexpr size_t SMALL_FILE_BYTES = 16 * 1024;
+constexpr size_t FILES_PER_DIR = 100;
+// A few large files, where the I/O buffer size sets the number of read and write calls.
+constexpr size_t LARGE_FILE_COUNT = 4;
+constexpr size_t LARGE_FILE_BYTES = 8 * 1024 * 1024;
+constexpr int BUFFER_SIZES[] = { 8 * 1024, 64 * 1024, kDefaultZipBufSize, 1024 * 1024, kMaxZipBufSize };
+
+// Text of words from a small vocabulary, compresses roughly like source code.
+constexpr uint32_t LCG_MULTIPLIER = 1103515245;
+constexpr uint32_t LCG_INCREMENT = 12345;
+constexpr uint32_t LCG_SHIFT = 16;
+const char* const WORDS[] = { "return", "const", "value", "size_t", "buffer", "entry", "std::string", "if", "for",
+    "nullptr", "options", "zip", "file", "path", "result", "{", "}", "(", ")", ";", "\n" };
+
+struct BenchResult {
+    std::string operation;
+    std::string variant;
+    size_t inputBytes = 0;
+    size_t runs = 0;
+    double seconds = 0;
+    double mbPerSecond = 0;
+};
+
+double g_minSeconds = DEFAULT_MIN_SECONDS;
+size_t g_fileCount = DEFAULT_FILE_COUNT;
+std::vector<BenchResult> g_results;
+
+std::string CreateContent(size_t bytes, uint32_t seed)
+{
+    std::string content;
+    content.reserve(bytes);
+    uint32_t state = seed;
+    while (content.size() < bytes) {
+        state = state * LCG_MULTIPLIER + LCG_INCREMENT;
+        content += WORDS[(state >> LCG_SHIFT) % (sizeof(WORDS) / sizeof(WORDS[0]))];
+        content += ' ';
+    }
+    content.resize(bytes);
+    return content;
+}
+
+bool WriteFile(const std::string& path, const std::string& content)
+{
+    FILE* file = fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        perror(path.c_str());
+        return false;
+    }
+    bool written = fwrite(content.data(), 1, content.size(), file) == content.size();
+    return fclose(file) == 0 && written;
+}
+
+// Writes |count| files of |bytes| each under |root|, returns their paths relative to |root|.
+bool CreateTree(const std::string& root, size_t count, size_t bytes, std::vector<FilePath>& files)
+{
+    if (mkdir(root.c_str(), S_IRWXU) != 0) {
+        perror(root.c_str());
+        return false;
+    }
+    for (size_t i = 0; i < count; i++) {
+        std::string dir = "d" + std::to_string(i / FILES_PER_DIR);
+        if (i % FILES_PER_DIR == 0 && mkdir((root + dir).c_str(), S_IRWXU) != 0) {
+            perror((root + dir).c_str());
+            return false;
+        }
+        std::string relative = dir + "/f" + std::to_string(i) + ".txt";
+        if (!WriteFile(root + relative, CreateContent(bytes, static_cast<uint32_t>(i)))) {
+            return false;
+        }
+        files.push_back(FilePath(relative));
+    }
+    return true;
+}
+
+// |root| ends with a separator, as Zip() passes it to ZipWriter.
+bool ZipFiles(const std::string& root, const std::vector<FilePath>& files, const std::string& dest,
+    const OPTIONS& options)
+{
+    unlink(dest.c_str());
+    zipFile zip = ZipWriter::InitZipFileWithFile(FilePath(dest));
+    if (zip == nullptr) {
+        return false;
+    }
+    ZipWriter writer(zip, FilePath(root));
+    return writer.WriteEntries(files, options);
+}
+
+// Extracts every file entry of |src| under |destDir| like the serial path of Unzip().
+bool UnzipFiles(const std::string& src, const std::string& destDir, int bufferSize)
+{
+    ZipReader reader;
+    FilePath srcPath(src);
+    if (!reader.Open(srcPath)) {
+        return false;
+    }
+    while (reader.HasMore()) {
+        if (!reader.OpenCurrentEntryInZip()) {
+            return false;
+        }
+        const ZipReader::EntryInfo* entryInfo = reader.CurrentEntryInfo();
+        if (!entryInfo->IsDirectory()) {
+            FilePath entryPath = entryInfo->GetFilePath();
+            FilePathWriterDelegate writer(FilePath(destDir + entryPath.Value()));
+            if (!reader.ExtractCurrentEntry(&writer, std::numeric_limits<uint64_t>::max(), bufferSize)) {
+                return false;
+            }
+        }
+        if (!reader.AdvanceToNextEntry()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Runs |body| until g_minSeconds were measured, at least once. Returns false if a run fails.
+template <typename Body>
+bool Measure(const std::string& operation, const std::string& variant, size_t inputBytes, const Body& body)
+{
+    BenchResult result { operation, variant, inputBytes };
+    while (result.runs == 0 || result.seconds < g_minSeconds) {
+        auto start = Clock::now();
+        if (!body()) {
+            fprintf(stderr, "%s %s failed\n", operation.c_str(), variant.c_str());
+            return false;
+        }
+        result.seconds += std::chrono::duration<double>(Clock::now() - start).count();
+        result.runs++;
+    }
+    result.mbPerSecond = inputBytes * result.runs / BYTES_PER_MB / result.seconds;
+    g_results.push_back(result);
+    return true;
+}
+
+std::vector<int> GetParallelCounts()
+{
+    std::vector<int> counts;
+    for (int parallel = 1; parallel < GetMaxZipParallel(); parallel *= 2) {
+        counts.push_back(parallel);
+    }
+    counts.push_back(GetMaxZipParallel());
+    return counts;
+}
+
+bool RunParallelZipBenchmarks(const std::string& workDir)
+{
+    std::string root = workDir + "/tree/";
+    std::vector<FilePath> files;
+    if (!CreateTree(root, g_fileCount, SMALL_FILE_BYTES, files)) {
+        return false;
+    }
+    size_t inputBytes = g_fileCount * SMALL_FILE_BYTES;
+    std::string dest = workDir + "/tree.zip";
+    for (int parallel : GetParallelCounts()) {
+        OPTIONS options;
+        options.parallel = parallel;
+        if (!Measure("zip_tree", "parallel=" + std::to_string(parallel), inputBytes,
+            [&root, &files, &dest, &options]() { return ZipFiles(root, files, dest, options); })) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool RunBufferSizeBenchmarks(const std::string& workDir)
+{
+    std::string root = workDir + "/large/";
+    std::vector<FilePath> files;
+    if (!CreateTree(root, LARGE_FILE_COUNT, LARGE_FILE_BYTES, files)) {
+        return false;
+    }
+    size_t inputBytes = LARGE_FILE_COUNT * LARGE_FILE_BYTES;
+    std::string dest = workDir + "/large.zip";
+    std::string extractDir = workDir + "/extract/";
+    for (int bufferSize : BUFFER_SIZES) {
+        OPTIONS options;
+        options.bufferSize = bufferSize;
+        std::string variant = "buffer=" + std::to_string(bufferSize / 1024) + "k";
+        if (!Measure("zip_large", variant, inputBytes,
+            [&root, &files, &dest, &options]() { return ZipFiles(root, files, dest, options); })) {
+            return false;
+        }
+        // Extracts the archive just written, every run overwrites the same output files.
+        if (!Measure("unzip_large", variant, inputBytes,
+            [&dest, &extractDir, bufferSize]() { return UnzipFiles(dest, extractDir, bufferSize); })) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void PrintJson()
+{
+    printf("{\"benchmark\":\"zip\",\"min_time_s\":%g,\"files\":%zu,\"results\":[", g_minSeconds, g_fileCount);
+    for (size_t i = 0; i < g_results.size(); i++) {
+        const BenchResult& r = g_results[i];
+        printf("%s\n{\"op\":\"%s\",\"variant\":\"%s\",\"input_bytes\":%zu,\"runs\":%zu,\"ms_per_run\":%.2f,"
+            "\"mb_per_s\":%.2f}", i == 0 ? "" : ",", r.operation.c_str(), r.variant.c_str(), r.inputBytes, r.runs,
+            r.seconds * 1000 / r.runs, r.mbPerSecond);
+    }
+    printf("\n]}\n");
+}
+
+void PrintCsv()
+{
+    printf("op,variant,input_bytes,runs,ms_per_run,mb_per_s\n");
+    for (const auto& r : g_results) {
+        printf("%s,%s,%zu,%zu,%.2f,%.2f\n", r.operation.c_str(), r.variant.c_str(), r.inputBytes, r.runs,
+            r.seconds * 1000 / r.runs, r.mbPerSecond);
+    }
+}
+} // namespace
+} // namespace OHOS::AppExecFwk::LIBZIP
+
+int main(int argc, char* argv[])
+{
+    using namespace OHOS::AppExecFwk::LIBZIP;
+    bool csv = false;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--format=csv") {
+            csv = true;
+        } else if (arg == "--format=json") {
+            csv = false;
+        } else if (arg.rfind("--min-time=", 0) == 0) {
+            g_minSeconds = std::atof(arg.c_str() + strlen("--min-time="));
+        } else if (arg.rfind("--files=", 0) == 0) {
+            g_fileCount = std::max(std::atoi(arg.c_str() + strlen("--files=")), 1);
+        } else {
+            fprintf(stderr, "Usage: %s [--format=json|csv] [--min-time=<seconds>] [--files=<count>]\n", argv[0]);
+            return 1;
+        }
+    }
+    char dirTemplate[] = "/tmp/zip_benchmark.XXXXXX";
+    if (mkdtemp(dirTemplate) == nullptr) {
+        perror("mkdtemp");
+        return 1;
+    }
+    std::string workDir = dirTemplate;
+    bool succeeded = RunParallelZipBenchmarks(workDir) && RunBufferSizeBenchmarks(workDir);
+    std::string cleanup = "rm -rf '" + workDir + "'";
+    if (system(cleanup.c_str()) != 0) {
+        fprintf(stderr, "failed to remove %s\n", workDir.c_str());
+    }
+    if (!succeeded) {
+        return 1;
+    }
+    if (csv) {
+        PrintCsv();
+    } else {
+        PrintJson();
+    }
+    return 0;
+}
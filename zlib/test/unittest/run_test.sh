@@ -0,0 +1,41 @@
+#!/bin/bash
+# Copyright (c) 2026 Huawei Device Co., Ltd.
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# Builds the zlib host tests with the host compiler and runs them, without GN.
+#
+# Usage: ./run_test.sh
+#
+# Third-party headers are taken from the source tree next to plugins/ unless
+# overridden:
+#   ZLIB_DIR  zlib checkout containing contrib/minizip/unzip.h
+#   CXX       host C++ compiler (default g++)
+#   OUT_DIR   build directory (default ${TMPDIR:-/tmp}/zlib_unittest)
+
+set -euo pipefail
+
+SCRIPT_DIR="$(cd "$(dirname "$0")" && pwd)"
+ZLIB_PLUGIN_DIR="$(cd "${SCRIPT_DIR}/../.." && pwd)"
+SOURCE_ROOT="$(dirname "$(dirname "${ZLIB_PLUGIN_DIR}")")"
+ZLIB_DIR="${ZLIB_DIR:-${SOURCE_ROOT}/third_party/zlib}"
+CXX="${CXX:-g++}"
+OUT_DIR="${OUT_DIR:-${TMPDIR:-/tmp}/zlib_unittest}"
+
+mkdir -p "${OUT_DIR}"
+
+"${CXX}" -std=c++17 -O2 -Wall -Wextra \
+    -I"${ZLIB_PLUGIN_DIR}/include" -I"${ZLIB_DIR}" \
+    "${ZLIB_PLUGIN_DIR}/src/zip_entry_index_cache.cpp" \
+    "${SCRIPT_DIR}/zip_entry_index_cache_test.cpp" \
+    -o "${OUT_DIR}/zip_entry_index_cache_test"
+
+"${OUT_DIR}/zip_entry_index_cache_test"
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Host test of the entry index cache of ZipReader::OpenIndexed(): replaced
+// archives must not be served from the cache and the least recently used
+// archive is evicted first. Exits non-zero on the first failed check.
+
+#include <cstdio>
+#include <cstdlib>
+#include <fcntl.h>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "zip_entry_index_cache.h"
+
+using namespace OHOS::AppExecFwk::LIBZIP;
+
+namespace {
+int g_failures = 0;
+
+#define EXPECT_TRUE(cond)                                                            \
+    do {                                                                             \
+        if (!(cond)) {                                                               \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            g_failures++;                                                            \
+        }                                                                            \
+    } while (0)
+
+std::string MakeTempFile(const std::string& dir, const std::string& name, const std::string& content)
+{
+    std::string path = dir + "/" + name;
+    FILE* file = fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        perror(path.c_str());
+        exit(1);
+    }
+    fwrite(content.data(), 1, content.size(), file);
+    fclose(file);
+    return path;
+}
+
+struct stat StatFile(const std::string& path)
+{
+    struct stat fileStat = {};
+    if (stat(path.c_str(), &fileStat) != 0) {
+        perror(path.c_str());
+        exit(1);
+    }
+    return fileStat;
+}
+
+std::shared_ptr<const ZipEntryIndex> MakeIndex(const std::string& name)
+{
+    auto index = std::make_shared<ZipEntryIndex>();
+    index->emplace(name, unz64_file_pos {});
+    return index;
+}
+
+void TestHitWhileUnchanged(const std::string& dir)
+{
+    ZipEntryIndexCache cache(ZipEntryIndexCache::DEFAULT_CAPACITY);
+    std::string path = MakeTempFile(dir, "hit.zip", "archive");
+    auto index = MakeIndex("a.txt");
+    cache.Insert(path, StatFile(path), index);
+    EXPECT_TRUE(cache.Find(path, StatFile(path)) == index);
+    EXPECT_TRUE(cache.Find(dir + "/missing.zip", StatFile(path)) == nullptr);
+}
+
+void TestMissAfterSizeChange(const std::string& dir)
+{
+    ZipEntryIndexCache cache(ZipEntryIndexCache::DEFAULT_CAPACITY);
+    std::string path = MakeTempFile(dir, "size.zip", "archive");
+    struct stat before = StatFile(path);
+    cache.Insert(path, before, MakeIndex("a.txt"));
+    MakeTempFile(dir, "size.zip", "a longer archive");
+    // Keep the modification time so only the size tells the files apart.
+    struct timespec times[] = { before.st_atim, before.st_mtim };
+    EXPECT_TRUE(utimensat(AT_FDCWD, path.c_str(), times, 0) == 0);
+    EXPECT_TRUE(cache.Find(path, StatFile(path)) == nullptr);
+    // The stale entry is dropped rather than kept around.
+    EXPECT_TRUE(cache.Size() == 0);
+}
+
+void TestMissAfterMtimeChange(const std::string& dir)
+{
+    ZipEntryIndexCache cache(ZipEntryIndexCache::DEFAULT_CAPACITY);
+    std::string path = MakeTempFile(dir, "mtime.zip", "archive");
+    struct stat before = StatFile(path);
+    cache.Insert(path, before, MakeIndex("a.txt"));
+    // Same size, only the nanoseconds of the modification time differ.
+    struct timespec modified = before.st_mtim;
+    modified.tv_nsec = (modified.tv_nsec + 1) % 1000000000L;
+    struct timespec times[] = { before.st_atim, modified };
+    EXPECT_TRUE(utimensat(AT_FDCWD, path.c_str(), times, 0) == 0);
+    EXPECT_TRUE(cache.Find(path, StatFile(path)) == nullptr);
+    EXPECT_TRUE(cache.Size() == 0);
+}
+
+void TestReinsertReplaces(const std::string& dir)
+{
+    ZipEntryIndexCache cache(ZipEntryIndexCache::DEFAULT_CAPACITY);
+    std::string path = MakeTempFile(dir, "reinsert.zip", "archive");
+    cache.Insert(path, StatFile(path), MakeIndex("a.txt"));
+    auto index = MakeIndex("b.txt");
+    cache.Insert(path, StatFile(path), index);
+    EXPECT_TRUE(cache.Size() == 1);
+    EXPECT_TRUE(cache.Find(path, StatFile(path)) == index);
+}
+
+void TestEvictsLeastRecentlyUsed(const std::string& dir)
+{
+    ZipEntryIndexCache cache(2);
+    std::string first = MakeTempFile(dir, "first.zip", "1");
+    std::string second = MakeTempFile(dir, "second.zip", "22");
+    std::string third = MakeTempFile(dir, "third.zip", "333");
+    cache.Insert(first, StatFile(first), MakeIndex("a.txt"));
+    cache.Insert(second, StatFile(second), MakeIndex("a.txt"));
+    // A hit makes |first| the most recently used, so |second| goes next.
+    EXPECT_TRUE(cache.Find(first, StatFile(first)) != nullptr);
+    cache.Insert(third, StatFile(third), MakeIndex("a.txt"));
+    EXPECT_TRUE(cache.Size() == 2);
+    EXPECT_TRUE(cache.Find(second, StatFile(second)) == nullptr);
+    EXPECT_TRUE(cache.Find(first, StatFile(first)) != nullptr);
+    EXPECT_TRUE(cache.Find(third, StatFile(third)) != nullptr);
+}
+} // namespace
+
+int main()
+{
+    char dirTemplate[] = "/tmp/zip_entry_index_cache_test.XXXXXX";
+    if (mkdtemp(dirTemplate) == nullptr) {
+        perror("mkdtemp");
+        return 1;
+    }
+    std::string dir = dirTemplate;
+    TestHitWhileUnchanged(dir);
+    TestMissAfterSizeChange(dir);
+    TestMissAfterMtimeChange(dir);
+    TestReinsertReplaces(dir);
+    TestEvictsLeastRecentlyUsed(dir);
+    std::string cleanup = "rm -rf '" + dir + "'";
+    if (system(cleanup.c_str()) != 0) {
+        fprintf(stderr, "failed to remove %s\n", dir.c_str());
+    }
+    if (g_failures != 0) {
+        fprintf(stderr, "%d check(s) failed\n", g_failures);
+        return 1;
+    }
+    printf("zip_entry_index_cache_test: all checks passed\n");
+    return 0;
+}